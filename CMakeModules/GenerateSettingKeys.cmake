@@ -10,6 +10,7 @@ foreach(KEY IN ITEMS
     "enable_gamemode"
     "use_cpu_jit"
     "cpu_clock_percentage"
+    "enable_idle_loop_skipping"
     "is_new_3ds"
     "lle_applets"
     "deterministic_async_operations"
@@ -38,6 +39,7 @@ foreach(KEY IN ITEMS
     "disable_spirv_optimizer"
     "async_shader_compilation"
     "async_presentation"
+    "parallel_command_recording"
     "use_hw_shader"
     "use_disk_shader_cache"
     "shaders_accurate_mul"
@@ -106,6 +108,7 @@ foreach(KEY IN ITEMS
     "audio_emulation"
     "enable_audio_stretching"
     "enable_realtime_audio"
+    "enable_polyphase_interpolation"
     "volume"
     "output_type"
     "output_device"
@@ -12,6 +12,7 @@ object SettingKeys {
     external fun use_artic_base_controller(): String
     external fun use_cpu_jit(): String
     external fun cpu_clock_percentage(): String
+    external fun enable_idle_loop_skipping(): String
     external fun is_new_3ds(): String
     external fun lle_applets(): String
     external fun deterministic_async_operations(): String
@@ -35,6 +36,7 @@ object SettingKeys {
     external fun disable_spirv_optimizer(): String
     external fun async_shader_compilation(): String
     external fun async_presentation(): String
+    external fun parallel_command_recording(): String
     external fun use_hw_shader(): String
     external fun use_disk_shader_cache(): String
     external fun shaders_accurate_mul(): String
@@ -92,6 +92,10 @@ static const char* android_config_default_file_content = (BOOST_HANA_STRING(R"(
 # Range is any positive integer (but we suspect 25 - 400 is a good idea) Default is 100
 )") DECLARE_KEY(cpu_clock_percentage) BOOST_HANA_STRING(R"(
 
+# Whether to skip ahead to the next scheduled event when the CPU is stuck in an idle loop (JIT only)
+# 0: Disabled, 1 (default): Enabled
+)") DECLARE_KEY(enable_idle_loop_skipping) BOOST_HANA_STRING(R"(
+
 [Renderer]
 # Whether to render using OpenGL
 # 1: OpenGL ES, 2: Vulkan (default)
@@ -219,6 +223,11 @@ static const char* android_config_default_file_content = (BOOST_HANA_STRING(R"(
 # 0: Enable async presentation, 1 (default): Disable async presentation
 )") DECLARE_KEY(async_presentation) BOOST_HANA_STRING(R"(
 
+# Record Vulkan commands of separate render passes on multiple threads
+# May improve performance on CPUs with many cores at high resolutions.
+# 0 (default): Disabled, 1: Enabled
+)") DECLARE_KEY(parallel_command_recording) BOOST_HANA_STRING(R"(
+
 # Which texture filter should be used
 # 0 (default): NoFilter
 # 1: Anime4K
@@ -424,6 +433,11 @@ static const char* android_config_default_file_content = (BOOST_HANA_STRING(R"(
 # 0 (default): No, 1: Yes
 )") DECLARE_KEY(enable_realtime_audio) BOOST_HANA_STRING(R"(
 
+# Resamples sources set to polyphase interpolation with an approximation of the DSP's filter
+# instead of linear interpolation. The approximation hasn't been validated against hardware yet.
+# 0 (default): No, 1: Yes
+)") DECLARE_KEY(enable_polyphase_interpolation) BOOST_HANA_STRING(R"(
+
 # Simulates whether headphones are plugged in to the emulated 3DS system
 # 0 (default): No, 1: Yes
 )") DECLARE_KEY(simulate_headphones_plugged) BOOST_HANA_STRING(R"(
@@ -0,0 +1,21 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "jni/emu_window/emu_window_null.h"
+
+namespace {
+
+class NullContext final : public Frontend::GraphicsContext {};
+
+} // Anonymous namespace
+
+EmuWindow_Android_Null::EmuWindow_Android_Null(ANativeWindow* surface, bool is_secondary)
+    : EmuWindow_Android{surface, is_secondary} {
+    core_context = CreateSharedContext();
+    OnFramebufferSizeChanged();
+}
+
+std::unique_ptr<Frontend::GraphicsContext> EmuWindow_Android_Null::CreateSharedContext() const {
+    return std::make_unique<NullContext>();
+}
@@ -0,0 +1,20 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "jni/emu_window/emu_window.h"
+
+struct ANativeWindow;
+
+/// Window for the null renderer, which never presents and so needs no graphics context.
+class EmuWindow_Android_Null : public EmuWindow_Android {
+public:
+    EmuWindow_Android_Null(ANativeWindow* surface, bool is_secondary);
+    ~EmuWindow_Android_Null() override = default;
+
+    void PollEvents() override {}
+
+    std::unique_ptr<GraphicsContext> CreateSharedContext() const override;
+};
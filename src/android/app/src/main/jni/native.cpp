@@ -51,6 +51,7 @@
 #include "jni/camera/ndk_camera.h"
 #include "jni/camera/still_image_camera.h"
 #include "jni/config.h"
+#include "jni/emu_window/emu_window_null.h"
 #include "network/announce_multiplayer_session.h"
 
 #ifdef ENABLE_OPENGL
@@ -265,6 +266,10 @@ static Core::System::ResultStatus RunCitra(const std::string& filepath) {
             std::make_unique<EmuWindow_Android_Vulkan>(s_secondary_surface, vulkan_library, true);
         break;
 #endif
+    case Settings::GraphicsAPI::Null:
+        window = std::make_unique<EmuWindow_Android_Null>(s_surface, false);
+        secondary_window = std::make_unique<EmuWindow_Android_Null>(s_secondary_surface, true);
+        break;
     default:
         LOG_CRITICAL(Frontend,
                      "Unknown or unsupported graphics API {}, falling back to available default",
@@ -280,8 +285,8 @@ static Core::System::ResultStatus RunCitra(const std::string& filepath) {
         secondary_window =
             std::make_unique<EmuWindow_Android_Vulkan>(s_secondary_surface, vulkan_library, true);
 #else
-        // TODO: Add a null renderer backend for this, perhaps.
-#error "At least one renderer must be enabled."
+        window = std::make_unique<EmuWindow_Android_Null>(s_surface, false);
+        secondary_window = std::make_unique<EmuWindow_Android_Null>(s_secondary_surface, true);
 #endif
         break;
     }
@@ -6,15 +6,27 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
-#include "audio_core/audio_types.h"
 #include "audio_core/codec.h"
 #include "common/assert.h"
 #include "common/common_types.h"
 
+#if defined(CITRA_HAS_SSE42)
+#include <emmintrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(__ARM_NEON)
+#define CITRA_HAS_NEON
+#include <arm_neon.h>
+#endif
+
 namespace AudioCore::Codec {
 
-StereoBuffer16 DecodeADPCM(const u8* const data, const std::size_t sample_count,
-                           const std::array<s16, 16>& adpcm_coeff, ADPCMState& state) {
+static_assert(sizeof(StereoBuffer16::Sample) == 2 * sizeof(s16),
+              "Decoded samples are written as interleaved s16 pairs");
+
+void DecodeADPCM(const u8* const data, const std::size_t sample_count,
+                 const std::array<s16, 16>& adpcm_coeff, ADPCMState& state,
+                 StereoBuffer16& output) {
     // GC-ADPCM with scale factor and variable coefficients.
     // Frames are 8 bytes long containing 14 samples each.
     // Samples are 4 bits (one nibble) long.
@@ -27,14 +39,12 @@ StereoBuffer16 DecodeADPCM(const u8* const data, const std::size_t sample_count,
 
     const std::size_t ret_size =
         sample_count % 2 == 0 ? sample_count : sample_count + 1; // Ensure multiple of two.
-    StereoBuffer16 ret(ret_size);
+    const std::span<StereoBuffer16::Sample> ret = output.Reset(ret_size);
 
     int yn1 = state.yn1, yn2 = state.yn2;
 
-    const std::size_t NUM_FRAMES =
-        (sample_count + (SAMPLES_PER_FRAME - 1)) / SAMPLES_PER_FRAME; // Round up.
-    for (std::size_t framei = 0; framei < NUM_FRAMES; framei++) {
-        const int frame_header = data[framei * FRAME_LEN];
+    for (std::size_t outputi = 0, datai = 0; outputi < ret_size; datai += FRAME_LEN) {
+        const int frame_header = data[datai];
         const int scale = 1 << (frame_header & 0xF);
         const int idx = (frame_header >> 4) & 0x7;
 
@@ -42,9 +52,11 @@ StereoBuffer16 DecodeADPCM(const u8* const data, const std::size_t sample_count,
         const int coef1 = adpcm_coeff[idx * 2 + 0];
         const int coef2 = adpcm_coeff[idx * 2 + 1];
 
-        // Decodes an audio sample. One nibble produces one sample.
-        const auto decode_sample = [&](const int nibble) -> s16 {
-            const int xn = nibble * scale;
+        const std::size_t frame_samples = std::min(SAMPLES_PER_FRAME, ret_size - outputi);
+        const u8* nibbles = data + datai + 1;
+        for (std::size_t i = 0; i < frame_samples; i++) {
+            const u8 byte = nibbles[i / 2];
+            const int xn = SIGNED_NIBBLES[i % 2 == 0 ? byte >> 4 : byte & 0xF] * scale;
             // We first transform everything into 11 bit fixed point, perform the second order
             // digital filter, then transform back.
             // 0x400 == 0.5 in 11 bit fixed point.
@@ -55,72 +67,107 @@ StereoBuffer16 DecodeADPCM(const u8* const data, const std::size_t sample_count,
             // Advance output feedback.
             yn2 = yn1;
             yn1 = val;
-            return (s16)val;
-        };
-
-        std::size_t outputi = framei * SAMPLES_PER_FRAME;
-        std::size_t datai = framei * FRAME_LEN + 1;
-        for (std::size_t i = 0; i < SAMPLES_PER_FRAME && outputi < sample_count; i += 2) {
-            const s16 sample1 = decode_sample(SIGNED_NIBBLES[data[datai] >> 4]);
-            ret[outputi].fill(sample1);
-            outputi++;
-
-            const s16 sample2 = decode_sample(SIGNED_NIBBLES[data[datai] & 0xF]);
-            ret[outputi].fill(sample2);
-            outputi++;
-
-            datai++;
+            ret[outputi++].fill(static_cast<s16>(val));
         }
     }
 
     state.yn1 = static_cast<s16>(yn1);
     state.yn2 = static_cast<s16>(yn2);
-
-    return ret;
 }
 
-StereoBuffer16 DecodePCM8(const unsigned num_channels, const u8* const data,
-                          const std::size_t sample_count) {
+void DecodePCM8(const unsigned num_channels, const u8* const data, const std::size_t sample_count,
+                StereoBuffer16& output) {
     ASSERT(num_channels == 1 || num_channels == 2);
 
-    const auto decode_sample = [](u8 sample) {
-        return static_cast<s16>(static_cast<u16>(sample) << 8);
-    };
-
-    StereoBuffer16 ret(sample_count);
-
-    if (num_channels == 1) {
-        for (std::size_t i = 0; i < sample_count; i++) {
-            ret[i].fill(decode_sample(data[i]));
+    const std::span<StereoBuffer16::Sample> ret = output.Reset(sample_count);
+    s16* out = ret.data()->data();
+
+    // Every byte becomes the high half of an s16. Mono samples are duplicated to both channels,
+    // stereo ones are already interleaved the same way as the output.
+    const std::size_t in_count = sample_count * num_channels;
+    std::size_t i = 0;
+#if defined(CITRA_HAS_SSE42)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= in_count; i += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i lo = _mm_unpacklo_epi8(zero, bytes);
+        const __m128i hi = _mm_unpackhi_epi8(zero, bytes);
+        __m128i* dest = reinterpret_cast<__m128i*>(out + i * (3 - num_channels));
+        if (num_channels == 1) {
+            _mm_storeu_si128(dest + 0, _mm_unpacklo_epi16(lo, lo));
+            _mm_storeu_si128(dest + 1, _mm_unpackhi_epi16(lo, lo));
+            _mm_storeu_si128(dest + 2, _mm_unpacklo_epi16(hi, hi));
+            _mm_storeu_si128(dest + 3, _mm_unpackhi_epi16(hi, hi));
+        } else {
+            _mm_storeu_si128(dest + 0, lo);
+            _mm_storeu_si128(dest + 1, hi);
         }
-    } else {
-        for (std::size_t i = 0; i < sample_count; i++) {
-            ret[i][0] = decode_sample(data[i * 2 + 0]);
-            ret[i][1] = decode_sample(data[i * 2 + 1]);
+    }
+#elif defined(CITRA_HAS_NEON)
+    for (; i + 16 <= in_count; i += 16) {
+        const uint8x16_t bytes = vld1q_u8(data + i);
+        const int16x8_t lo = vreinterpretq_s16_u16(vshll_n_u8(vget_low_u8(bytes), 8));
+        const int16x8_t hi = vreinterpretq_s16_u16(vshll_n_u8(vget_high_u8(bytes), 8));
+        s16* dest = out + i * (3 - num_channels);
+        if (num_channels == 1) {
+            const int16x8x2_t lo_pairs = vzipq_s16(lo, lo);
+            const int16x8x2_t hi_pairs = vzipq_s16(hi, hi);
+            vst1q_s16(dest + 0, lo_pairs.val[0]);
+            vst1q_s16(dest + 8, lo_pairs.val[1]);
+            vst1q_s16(dest + 16, hi_pairs.val[0]);
+            vst1q_s16(dest + 24, hi_pairs.val[1]);
+        } else {
+            vst1q_s16(dest + 0, lo);
+            vst1q_s16(dest + 8, hi);
+        }
+    }
+#endif
+    for (; i < in_count; i++) {
+        const s16 sample = static_cast<s16>(static_cast<u16>(data[i]) << 8);
+        if (num_channels == 1) {
+            out[i * 2 + 0] = sample;
+            out[i * 2 + 1] = sample;
+        } else {
+            out[i] = sample;
         }
     }
-
-    return ret;
 }
 
-StereoBuffer16 DecodePCM16(const unsigned num_channels, const u8* const data,
-                           const std::size_t sample_count) {
+void DecodePCM16(const unsigned num_channels, const u8* const data, const std::size_t sample_count,
+                 StereoBuffer16& output) {
     ASSERT(num_channels == 1 || num_channels == 2);
 
-    StereoBuffer16 ret(sample_count);
+    const std::span<StereoBuffer16::Sample> ret = output.Reset(sample_count);
 
-    if (num_channels == 1) {
-        for (std::size_t i = 0; i < sample_count; i++) {
-            s16 sample;
-            std::memcpy(&sample, data + i * sizeof(s16), sizeof(s16));
-            ret[i].fill(sample);
-        }
-    } else {
-        for (std::size_t i = 0; i < sample_count; ++i) {
-            std::memcpy(&ret[i], data + i * sizeof(s16) * 2, 2 * sizeof(s16));
-        }
+    if (num_channels == 2) {
+        // Interleaved stereo data is laid out exactly like the output.
+        std::memcpy(ret.data(), data, sample_count * 2 * sizeof(s16));
+        return;
     }
 
-    return ret;
+    s16* out = ret.data()->data();
+    std::size_t i = 0;
+#if defined(CITRA_HAS_SSE42)
+    for (; i + 8 <= sample_count; i += 8) {
+        const __m128i samples =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * sizeof(s16)));
+        __m128i* dest = reinterpret_cast<__m128i*>(out + i * 2);
+        _mm_storeu_si128(dest + 0, _mm_unpacklo_epi16(samples, samples));
+        _mm_storeu_si128(dest + 1, _mm_unpackhi_epi16(samples, samples));
+    }
+#elif defined(CITRA_HAS_NEON)
+    for (; i + 8 <= sample_count; i += 8) {
+        const int16x8_t samples = vreinterpretq_s16_u8(vld1q_u8(data + i * sizeof(s16)));
+        const int16x8x2_t pairs = vzipq_s16(samples, samples);
+        vst1q_s16(out + i * 2 + 0, pairs.val[0]);
+        vst1q_s16(out + i * 2 + 8, pairs.val[1]);
+    }
+#endif
+    for (; i < sample_count; i++) {
+        s16 sample;
+        std::memcpy(&sample, data + i * sizeof(s16), sizeof(s16));
+        out[i * 2 + 0] = sample;
+        out[i * 2 + 1] = sample;
+    }
 }
 } // namespace AudioCore::Codec
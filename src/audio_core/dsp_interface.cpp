@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cmath>
 #include <cstddef>
 #include "audio_core/dsp_interface.h"
 #include "audio_core/sink.h"
@@ -13,7 +14,19 @@
 
 namespace AudioCore {
 
-DspInterface::DspInterface(Core::System& system_) : system(system_) {}
+namespace {
+/// Production rate below which time stretching starts.
+constexpr double start_stretching_rate = 0.95;
+/// Production rate at which time stretching stops. Higher than the start threshold, so that
+/// small variations of the emulation speed do not switch back and forth.
+constexpr double stop_stretching_rate = 0.98;
+/// Time scale of the low-pass filter applied to the production rate.
+constexpr double production_rate_time_scale = 0.5; // seconds
+} // Anonymous namespace
+
+DspInterface::DspInterface(Core::System& system_) : system(system_) {
+    stretch_buffer.resize(fifo.Capacity() * 2);
+}
 
 DspInterface::~DspInterface() = default;
 
@@ -21,6 +34,11 @@ void DspInterface::SetSink(AudioCore::SinkType sink_type, std::string_view audio
     // Dispose of the current sink first to avoid contention.
     sink.reset();
 
+    // The previous sink's callback is no longer running, so its latency state can be reset.
+    production_rate = 1.0;
+    fifo_level_after_pop = fifo.Size();
+    last_callback_frames = 0;
+
     sink = AudioCore::GetSinkDetails(sink_type).create_sink(audio_device);
     sink->SetCallback(
         [this](s16* buffer, std::size_t num_frames) { OutputCallback(buffer, num_frames); });
@@ -70,10 +88,28 @@ void DspInterface::OutputSample(std::array<s16, 2> sample) {
     }
 }
 
+void DspInterface::UpdateProductionRate(std::size_t frames_produced) {
+    if (last_callback_frames == 0) {
+        return;
+    }
+    const double time_delta = static_cast<double>(last_callback_frames) / native_sample_rate;
+    const double gain = 1.0 - std::exp(-time_delta / production_rate_time_scale);
+    const double current_rate =
+        static_cast<double>(frames_produced) / static_cast<double>(last_callback_frames);
+    production_rate += gain * (current_rate - production_rate);
+}
+
 void DspInterface::OutputCallback(s16* buffer, std::size_t num_frames) {
-    // Determine if we should stretch based on the current emulation speed.
-    const auto perf_stats = system.GetLastPerfStats();
-    const auto should_stretch = enable_time_stretching && perf_stats.emulation_speed <= 95;
+    // Everything added to the fifo since the last callback was produced while the sink played the
+    // frames it requested then. This measures the emulation speed as heard by the user, without
+    // having to synchronize with the emulation thread.
+    const std::size_t fifo_level = fifo.Size();
+    UpdateProductionRate(fifo_level - fifo_level_after_pop);
+    last_callback_frames = num_frames;
+
+    const double stretch_threshold =
+        performing_time_stretching ? stop_stretching_rate : start_stretching_rate;
+    const bool should_stretch = enable_time_stretching && production_rate < stretch_threshold;
     if (performing_time_stretching && !should_stretch) {
         // If we just stopped stretching, flush the stretcher before returning to normal output.
         flushing_time_stretcher = true;
@@ -82,9 +118,8 @@ void DspInterface::OutputCallback(s16* buffer, std::size_t num_frames) {
 
     std::size_t frames_written = 0;
     if (performing_time_stretching) {
-        const std::vector<s16> in{fifo.Pop()};
-        const std::size_t num_in{in.size() / 2};
-        frames_written = time_stretcher.Process(in.data(), num_in, buffer, num_frames);
+        const std::size_t num_in = fifo.Pop(stretch_buffer.data(), fifo.Capacity());
+        frames_written = time_stretcher.Process(stretch_buffer.data(), num_in, buffer, num_frames);
     } else {
         if (flushing_time_stretcher) {
             time_stretcher.Flush();
@@ -95,8 +130,9 @@ void DspInterface::OutputCallback(s16* buffer, std::size_t num_frames) {
             // so that they do not bleed into the next time the stretcher is enabled.
             time_stretcher.Clear();
         }
-        frames_written += fifo.Pop(buffer, num_frames - frames_written);
+        frames_written += fifo.Pop(buffer + 2 * frames_written, num_frames - frames_written);
     }
+    fifo_level_after_pop = fifo.Size();
 
     if (frames_written > 0) {
         std::memcpy(&last_frame[0], buffer + 2 * (frames_written - 1), 2 * sizeof(s16));
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <span>
+#include <vector>
 #include <boost/serialization/access.hpp>
 #include "audio_core/audio_types.h"
 #include "audio_core/time_stretch.h"
@@ -110,6 +111,8 @@ protected:
 private:
     void FlushResidualStretcherAudio();
     void OutputCallback(s16* buffer, std::size_t num_frames);
+    /// Updates the production rate estimate with the frames produced since the last callback.
+    void UpdateProductionRate(std::size_t frames_produced);
 
     Core::System& system;
 
@@ -121,6 +124,15 @@ private:
     TimeStretcher time_stretcher;
     std::unique_ptr<Sink> sink;
 
+    // Latency control state, only accessed from the sink's callback.
+
+    /// Rate at which frames are added to the fifo, relative to the rate the sink consumes them.
+    double production_rate = 1.0;
+    std::size_t fifo_level_after_pop = 0;
+    std::size_t last_callback_frames = 0;
+    /// Receives the contents of the fifo while stretching, sized to hold all of it.
+    std::vector<s16> stretch_buffer;
+
     template <class Archive>
     void serialize(Archive& ar, const unsigned int) {}
     friend class boost::serialization::access;
@@ -5,13 +5,73 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
-#include "audio_core/hle/common.h"
 #include "audio_core/hle/filter.h"
 #include "audio_core/hle/shared_memory.h"
 #include "common/common_types.h"
 
+#if defined(CITRA_HAS_SSE42)
+#include <smmintrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(__ARM_NEON)
+#define CITRA_HAS_NEON
+#include <arm_neon.h>
+#endif
+
 namespace AudioCore::HLE {
 
+namespace {
+
+using FeedforwardFrame = std::array<std::array<s32, 2>, samples_per_frame>;
+
+/**
+ * Computes the feedforward half of a filter, b0 * x[n] + b1 * x[n-1] + b2 * x[n-2], for both
+ * channels of every sample of a frame. It doesn't depend on earlier outputs, so unlike the
+ * feedback half it can be computed for the whole frame at once.
+ */
+void ComputeFeedforward(const StereoFrame16& frame, const std::array<s16, 2>& x2,
+                        const std::array<s16, 2>& x1, s32 b0, s32 b1, s32 b2,
+                        FeedforwardFrame& out) {
+    // The input preceded by its two historical samples.
+    std::array<std::array<s16, 2>, samples_per_frame + 2> x;
+    x[0] = x2;
+    x[1] = x1;
+    std::copy(frame.begin(), frame.end(), x.begin() + 2);
+
+    static_assert(samples_per_frame % 2 == 0);
+#if defined(CITRA_HAS_SSE42)
+    const __m128i b0v = _mm_set1_epi32(b0);
+    const __m128i b1v = _mm_set1_epi32(b1);
+    const __m128i b2v = _mm_set1_epi32(b2);
+    const auto load = [&x](std::size_t i) {
+        return _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&x[i])));
+    };
+    for (std::size_t i = 0; i < samples_per_frame; i += 2) {
+        const __m128i sum = _mm_add_epi32(
+            _mm_add_epi32(_mm_mullo_epi32(b0v, load(i + 2)), _mm_mullo_epi32(b1v, load(i + 1))),
+            _mm_mullo_epi32(b2v, load(i)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), sum);
+    }
+#elif defined(CITRA_HAS_NEON)
+    const auto load = [&x](std::size_t i) { return vmovl_s16(vld1_s16(x[i].data())); };
+    for (std::size_t i = 0; i < samples_per_frame; i += 2) {
+        int32x4_t sum = vmulq_n_s32(load(i + 2), b0);
+        sum = vmlaq_n_s32(sum, load(i + 1), b1);
+        sum = vmlaq_n_s32(sum, load(i), b2);
+        vst1q_s32(out[i].data(), sum);
+    }
+#else
+    for (std::size_t i = 0; i < samples_per_frame; i++) {
+        for (std::size_t channel = 0; channel < 2; channel++) {
+            out[i][channel] =
+                b0 * x[i + 2][channel] + b1 * x[i + 1][channel] + b2 * x[i][channel];
+        }
+    }
+#endif
+}
+
+} // Anonymous namespace
+
 void SourceFilters::Reset() {
     Enable(false, false);
 }
@@ -39,11 +99,11 @@ void SourceFilters::ProcessFrame(StereoFrame16& frame) {
         return;
 
     if (simple_filter_enabled) {
-        FilterFrame(frame, simple_filter);
+        simple_filter.ProcessFrame(frame);
     }
 
     if (biquad_filter_enabled) {
-        FilterFrame(frame, biquad_filter);
+        biquad_filter.ProcessFrame(frame);
     }
 }
 
@@ -75,6 +135,19 @@ std::array<s16, 2> SourceFilters::SimpleFilter::ProcessSample(const std::array<s
     return y0;
 }
 
+void SourceFilters::SimpleFilter::ProcessFrame(StereoFrame16& frame) {
+    FeedforwardFrame feedforward;
+    ComputeFeedforward(frame, {}, {}, b0, 0, 0, feedforward);
+
+    for (std::size_t i = 0; i < samples_per_frame; i++) {
+        for (std::size_t channel = 0; channel < 2; channel++) {
+            const s32 tmp = (feedforward[i][channel] + a1 * y1[channel]) >> 15;
+            y1[channel] = static_cast<s16>(std::clamp(tmp, -32768, 32767));
+        }
+        frame[i] = y1;
+    }
+}
+
 // BiquadFilter
 
 void SourceFilters::BiquadFilter::Reset() {
@@ -112,4 +185,22 @@ std::array<s16, 2> SourceFilters::BiquadFilter::ProcessSample(const std::array<s
     return y0;
 }
 
+void SourceFilters::BiquadFilter::ProcessFrame(StereoFrame16& frame) {
+    FeedforwardFrame feedforward;
+    ComputeFeedforward(frame, x2, x1, b0, b1, b2, feedforward);
+    x2 = frame[samples_per_frame - 2];
+    x1 = frame[samples_per_frame - 1];
+
+    for (std::size_t i = 0; i < samples_per_frame; i++) {
+        std::array<s16, 2> y0;
+        for (std::size_t channel = 0; channel < 2; channel++) {
+            const s32 tmp = (feedforward[i][channel] + a1 * y1[channel] + a2 * y2[channel]) >> 14;
+            y0[channel] = static_cast<s16>(std::clamp(tmp, -32768, 32767));
+        }
+        y2 = y1;
+        y1 = y0;
+        frame[i] = y0;
+    }
+}
+
 } // namespace AudioCore::HLE
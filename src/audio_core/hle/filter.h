@@ -73,6 +73,12 @@ private:
          */
         std::array<s16, 2> ProcessSample(const std::array<s16, 2>& x0);
 
+        /**
+         * Processes a frame in-place. Equivalent to calling ProcessSample on every sample.
+         * @param frame Audio samples to process. Modified in-place.
+         */
+        void ProcessFrame(StereoFrame16& frame);
+
     private:
         // Configuration
         s32 a1, b0;
@@ -101,6 +107,12 @@ private:
          */
         std::array<s16, 2> ProcessSample(const std::array<s16, 2>& x0);
 
+        /**
+         * Processes a frame in-place. Equivalent to calling ProcessSample on every sample.
+         * @param frame Audio samples to process. Modified in-place.
+         */
+        void ProcessFrame(StereoFrame16& frame);
+
     private:
         // Configuration
         s32 a1, a2, b0, b1, b2;
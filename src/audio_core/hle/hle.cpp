@@ -25,6 +25,7 @@
 #include "common/hash.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 
@@ -97,6 +98,13 @@ private:
     }};
     HLE::Mixers mixers{};
 
+    /// Sources are only ticked on the workers when at least this many of them were playing on the
+    /// previous frame, below that handing them over costs more than ticking them here.
+    static constexpr std::size_t min_parallel_sources = 8;
+    static constexpr std::size_t num_source_workers = 2;
+    Common::ThreadWorker source_workers{num_source_workers, "DSP HLE source workers"};
+    std::size_t active_sources = 0;
+
     HLE::DspMemory backup_dsp_memory;
 
     DspHle& parent;
@@ -417,13 +425,34 @@ StereoFrame16 DspHle::Impl::GenerateCurrentFrame() {
 
     std::array<QuadFrame32, 3> intermediate_mixes = {};
 
-    // Generate intermediate mixes
+    // Sources don't share any state, so they can be ticked concurrently. Each chunk takes every
+    // num_chunks-th source, as the playing ones tend to be the first few.
+    constexpr std::size_t num_chunks = num_source_workers + 1;
+    const auto tick_sources = [this, &read, &write](std::size_t chunk, std::size_t stride) {
+        for (std::size_t i = chunk; i < HLE::num_sources; i += stride) {
+            write.source_statuses.status[i] = sources[i].Tick(read.source_configurations.config[i],
+                                                              read.adpcm_coefficients.coeff[i]);
+        }
+    };
+    if (active_sources >= min_parallel_sources) {
+        for (std::size_t chunk = 1; chunk < num_chunks; chunk++) {
+            source_workers.QueueWork([&tick_sources, chunk] { tick_sources(chunk, num_chunks); });
+        }
+        tick_sources(0, num_chunks);
+        source_workers.WaitForRequests();
+    } else {
+        tick_sources(0, 1);
+    }
+
+    // Generate intermediate mixes, always in source order so the result is deterministic
+    active_sources = 0;
     for (std::size_t i = 0; i < HLE::num_sources; i++) {
-        write.source_statuses.status[i] =
-            sources[i].Tick(read.source_configurations.config[i], read.adpcm_coefficients.coeff[i]);
         for (std::size_t mix = 0; mix < 3; mix++) {
             sources[i].MixInto(intermediate_mixes[mix], mix);
         }
+        if (sources[i].IsEnabled()) {
+            active_sources++;
+        }
     }
 
     // Generate final mix
@@ -8,6 +8,15 @@
 #include "common/assert.h"
 #include "common/logging/log.h"
 
+#if defined(CITRA_HAS_SSE42)
+#include <emmintrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(__ARM_NEON)
+#define CITRA_HAS_NEON
+#include <arm_neon.h>
+#endif
+
 namespace AudioCore::HLE {
 
 void Mixers::Reset() {
@@ -96,6 +105,16 @@ void Mixers::ParseConfig(DspConfiguration& config) {
     config.dirty_raw = 0;
 }
 
+#if defined(CITRA_HAS_SSE42)
+static __m128i LoadI32x4(const void* source) {
+    return _mm_loadu_si128(static_cast<const __m128i*>(source));
+}
+
+static void StoreI32x4(void* dest, __m128i value) {
+    _mm_storeu_si128(static_cast<__m128i*>(dest), value);
+}
+#endif
+
 static s16 ClampToS16(s32 value) {
     return static_cast<s16>(std::clamp(value, -32768, 32767));
 }
@@ -109,10 +128,51 @@ static std::array<s16, 2> AddAndClampToS16(const std::array<s16, 2>& a,
 void Mixers::DownmixAndMixIntoCurrentFrame(float gain, const QuadFrame32& samples) {
     // TODO(merry): Limiter. (Currently we're performing final mixing assuming a disabled limiter.)
 
+    // The vectorized paths perform the same float operations in the same order as the scalar
+    // one, four samples at a time, so their results are identical.
+    static_assert(samples_per_frame % 4 == 0);
+
     switch (state.output_format) {
-    case OutputFormat::Mono:
+    case OutputFormat::Mono: {
+        std::size_t i = 0;
+#if defined(CITRA_HAS_SSE42)
+        const __m128 g = _mm_set1_ps(gain);
+        for (; i < samples_per_frame; i += 4) {
+            __m128 s0 = _mm_cvtepi32_ps(LoadI32x4(&samples[i + 0]));
+            __m128 s1 = _mm_cvtepi32_ps(LoadI32x4(&samples[i + 1]));
+            __m128 s2 = _mm_cvtepi32_ps(LoadI32x4(&samples[i + 2]));
+            __m128 s3 = _mm_cvtepi32_ps(LoadI32x4(&samples[i + 3]));
+            // Gather each channel of the four samples into a vector.
+            _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+            __m128 sum = _mm_add_ps(_mm_mul_ps(g, s0), _mm_mul_ps(g, s1));
+            sum = _mm_add_ps(sum, _mm_mul_ps(g, s2));
+            sum = _mm_add_ps(sum, _mm_mul_ps(g, s3));
+            sum = _mm_div_ps(sum, _mm_set1_ps(2.0f));
+            const __m128i mono = _mm_packs_epi32(_mm_cvttps_epi32(sum), _mm_setzero_si128());
+            __m128i* accumulator = reinterpret_cast<__m128i*>(&current_frame[i]);
+            _mm_storeu_si128(accumulator, _mm_adds_epi16(_mm_loadu_si128(accumulator),
+                                                         _mm_unpacklo_epi16(mono, mono)));
+        }
+#elif defined(CITRA_HAS_NEON)
+        for (; i < samples_per_frame; i += 4) {
+            // Loads each channel of the four samples into a vector.
+            const int32x4x4_t quad = vld4q_s32(samples[i].data());
+            float32x4_t sum = vaddq_f32(vmulq_n_f32(vcvtq_f32_s32(quad.val[0]), gain),
+                                        vmulq_n_f32(vcvtq_f32_s32(quad.val[1]), gain));
+            sum = vaddq_f32(sum, vmulq_n_f32(vcvtq_f32_s32(quad.val[2]), gain));
+            sum = vaddq_f32(sum, vmulq_n_f32(vcvtq_f32_s32(quad.val[3]), gain));
+            // Halving is exact, so this matches a division by two.
+            sum = vmulq_n_f32(sum, 0.5f);
+            const int16x4_t mono = vqmovn_s32(vcvtq_s32_f32(sum));
+            const int16x4x2_t pairs = vzip_s16(mono, mono);
+            s16* accumulator = current_frame[i].data();
+            vst1q_s16(accumulator, vqaddq_s16(vld1q_s16(accumulator),
+                                              vcombine_s16(pairs.val[0], pairs.val[1])));
+        }
+#endif
         std::transform(
-            current_frame.begin(), current_frame.end(), samples.begin(), current_frame.begin(),
+            current_frame.begin() + i, current_frame.end(), samples.begin() + i,
+            current_frame.begin() + i,
             [gain](const std::array<s16, 2>& accumulator,
                    const std::array<s32, 4>& sample) -> std::array<s16, 2> {
                 // Downmix to mono
@@ -123,14 +183,47 @@ void Mixers::DownmixAndMixIntoCurrentFrame(float gain, const QuadFrame32& sample
                 return AddAndClampToS16(accumulator, {mono, mono});
             });
         return;
+    }
 
     case OutputFormat::Surround:
         // TODO(merry): Implement surround sound.
         // fallthrough
 
-    case OutputFormat::Stereo:
+    case OutputFormat::Stereo: {
+        std::size_t i = 0;
+#if defined(CITRA_HAS_SSE42)
+        const __m128 g = _mm_set1_ps(gain);
+        const auto load = [&samples, g](std::size_t index) {
+            return _mm_mul_ps(g, _mm_cvtepi32_ps(LoadI32x4(&samples[index])));
+        };
+        // Adds the rear channels to the front ones of two samples, giving {L0, R0, L1, R1}.
+        const auto downmix = [](__m128 a, __m128 b) {
+            return _mm_cvttps_epi32(_mm_add_ps(_mm_movelh_ps(a, b), _mm_movehl_ps(b, a)));
+        };
+        for (; i < samples_per_frame; i += 4) {
+            const __m128i stereo = _mm_packs_epi32(downmix(load(i + 0), load(i + 1)),
+                                                   downmix(load(i + 2), load(i + 3)));
+            __m128i* accumulator = reinterpret_cast<__m128i*>(&current_frame[i]);
+            _mm_storeu_si128(accumulator, _mm_adds_epi16(_mm_loadu_si128(accumulator), stereo));
+        }
+#elif defined(CITRA_HAS_NEON)
+        for (; i < samples_per_frame; i += 4) {
+            // Loads each channel of the four samples into a vector.
+            const int32x4x4_t quad = vld4q_s32(samples[i].data());
+            const float32x4_t left = vaddq_f32(vmulq_n_f32(vcvtq_f32_s32(quad.val[0]), gain),
+                                               vmulq_n_f32(vcvtq_f32_s32(quad.val[2]), gain));
+            const float32x4_t right = vaddq_f32(vmulq_n_f32(vcvtq_f32_s32(quad.val[1]), gain),
+                                                vmulq_n_f32(vcvtq_f32_s32(quad.val[3]), gain));
+            const int16x4x2_t pairs = vzip_s16(vqmovn_s32(vcvtq_s32_f32(left)),
+                                               vqmovn_s32(vcvtq_s32_f32(right)));
+            s16* accumulator = current_frame[i].data();
+            vst1q_s16(accumulator, vqaddq_s16(vld1q_s16(accumulator),
+                                              vcombine_s16(pairs.val[0], pairs.val[1])));
+        }
+#endif
         std::transform(
-            current_frame.begin(), current_frame.end(), samples.begin(), current_frame.begin(),
+            current_frame.begin() + i, current_frame.end(), samples.begin() + i,
+            current_frame.begin() + i,
             [gain](const std::array<s16, 2>& accumulator,
                    const std::array<s32, 4>& sample) -> std::array<s16, 2> {
                 // Downmix to stereo
@@ -141,30 +234,83 @@ void Mixers::DownmixAndMixIntoCurrentFrame(float gain, const QuadFrame32& sample
             });
         return;
     }
+    }
 
     UNREACHABLE_MSG("Invalid output_format {}", static_cast<std::size_t>(state.output_format));
 }
 
+/// Converts the channel-major samples of shared memory to a QuadFrame32.
+static void InterleaveChannels(const s32_le (&planar)[4][samples_per_frame], QuadFrame32& quad) {
+    std::size_t sample = 0;
+#if defined(CITRA_HAS_SSE42)
+    for (; sample < samples_per_frame; sample += 4) {
+        __m128 c0 = _mm_castsi128_ps(LoadI32x4(&planar[0][sample]));
+        __m128 c1 = _mm_castsi128_ps(LoadI32x4(&planar[1][sample]));
+        __m128 c2 = _mm_castsi128_ps(LoadI32x4(&planar[2][sample]));
+        __m128 c3 = _mm_castsi128_ps(LoadI32x4(&planar[3][sample]));
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+        StoreI32x4(&quad[sample + 0], _mm_castps_si128(c0));
+        StoreI32x4(&quad[sample + 1], _mm_castps_si128(c1));
+        StoreI32x4(&quad[sample + 2], _mm_castps_si128(c2));
+        StoreI32x4(&quad[sample + 3], _mm_castps_si128(c3));
+    }
+#elif defined(CITRA_HAS_NEON)
+    for (; sample < samples_per_frame; sample += 4) {
+        int32x4x4_t channels;
+        for (std::size_t channel = 0; channel < 4; channel++) {
+            channels.val[channel] =
+                vld1q_s32(reinterpret_cast<const s32*>(&planar[channel][sample]));
+        }
+        vst4q_s32(quad[sample].data(), channels);
+    }
+#endif
+    for (; sample < samples_per_frame; sample++) {
+        for (std::size_t channel = 0; channel < 4; channel++) {
+            quad[sample][channel] = planar[channel][sample];
+        }
+    }
+}
+
+/// Converts a QuadFrame32 to the channel-major samples of shared memory.
+static void DeinterleaveChannels(const QuadFrame32& quad, s32_le (&planar)[4][samples_per_frame]) {
+    std::size_t sample = 0;
+#if defined(CITRA_HAS_SSE42)
+    for (; sample < samples_per_frame; sample += 4) {
+        __m128 s0 = _mm_castsi128_ps(LoadI32x4(&quad[sample + 0]));
+        __m128 s1 = _mm_castsi128_ps(LoadI32x4(&quad[sample + 1]));
+        __m128 s2 = _mm_castsi128_ps(LoadI32x4(&quad[sample + 2]));
+        __m128 s3 = _mm_castsi128_ps(LoadI32x4(&quad[sample + 3]));
+        _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+        StoreI32x4(&planar[0][sample], _mm_castps_si128(s0));
+        StoreI32x4(&planar[1][sample], _mm_castps_si128(s1));
+        StoreI32x4(&planar[2][sample], _mm_castps_si128(s2));
+        StoreI32x4(&planar[3][sample], _mm_castps_si128(s3));
+    }
+#elif defined(CITRA_HAS_NEON)
+    for (; sample < samples_per_frame; sample += 4) {
+        const int32x4x4_t channels = vld4q_s32(quad[sample].data());
+        for (std::size_t channel = 0; channel < 4; channel++) {
+            vst1q_s32(reinterpret_cast<s32*>(&planar[channel][sample]), channels.val[channel]);
+        }
+    }
+#endif
+    for (; sample < samples_per_frame; sample++) {
+        for (std::size_t channel = 0; channel < 4; channel++) {
+            planar[channel][sample] = quad[sample][channel];
+        }
+    }
+}
+
 void Mixers::AuxReturn(const IntermediateMixSamples& read_samples) {
     // NOTE: read_samples.mix{1,2}.pcm32 annoyingly have their dimensions in reverse order to
     // QuadFrame32.
 
     if (state.aux_bus_enable[0]) {
-        for (std::size_t sample = 0; sample < samples_per_frame; sample++) {
-            for (std::size_t channel = 0; channel < 4; channel++) {
-                state.intermediate_mix_buffer[1][sample][channel] =
-                    read_samples.mix1.pcm32[channel][sample];
-            }
-        }
+        InterleaveChannels(read_samples.mix1.pcm32, state.intermediate_mix_buffer[1]);
     }
 
     if (state.aux_bus_enable[1]) {
-        for (std::size_t sample = 0; sample < samples_per_frame; sample++) {
-            for (std::size_t channel = 0; channel < 4; channel++) {
-                state.intermediate_mix_buffer[2][sample][channel] =
-                    read_samples.mix2.pcm32[channel][sample];
-            }
-        }
+        InterleaveChannels(read_samples.mix2.pcm32, state.intermediate_mix_buffer[2]);
     }
 }
 
@@ -176,21 +322,13 @@ void Mixers::AuxSend(IntermediateMixSamples& write_samples,
     state.intermediate_mix_buffer[0] = input[0];
 
     if (state.aux_bus_enable[0]) {
-        for (std::size_t sample = 0; sample < samples_per_frame; sample++) {
-            for (std::size_t channel = 0; channel < 4; channel++) {
-                write_samples.mix1.pcm32[channel][sample] = input[1][sample][channel];
-            }
-        }
+        DeinterleaveChannels(input[1], write_samples.mix1.pcm32);
     } else {
         state.intermediate_mix_buffer[1] = input[1];
     }
 
     if (state.aux_bus_enable[1]) {
-        for (std::size_t sample = 0; sample < samples_per_frame; sample++) {
-            for (std::size_t channel = 0; channel < 4; channel++) {
-                write_samples.mix2.pcm32[channel][sample] = input[2][sample][channel];
-            }
-        }
+        DeinterleaveChannels(input[2], write_samples.mix2.pcm32);
     } else {
         state.intermediate_mix_buffer[2] = input[2];
     }
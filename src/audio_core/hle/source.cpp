@@ -10,6 +10,7 @@
 #include "audio_core/interpolate.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "common/settings.h"
 #include "core/memory.h"
 
 namespace AudioCore::HLE {
@@ -37,28 +38,43 @@ void Source::MixInto(QuadFrame32& dest, std::size_t intermediate_mix_id) {
     const std::array<float, 4>& ramp_start = state.gain_ramp_start.at(intermediate_mix_id);
     constexpr float ramp_scale = 1.0f / static_cast<float>(samples_per_frame - 1);
 
-    for (std::size_t samplei = 0; samplei < samples_per_frame; samplei++) {
-        const float progress = static_cast<float>(samplei) * ramp_scale;
-        const float gain0 =
-            ramp_active ? ramp_start[0] + (gains[0] - ramp_start[0]) * progress : gains[0];
-        const float gain1 =
-            ramp_active ? ramp_start[1] + (gains[1] - ramp_start[1]) * progress : gains[1];
-        const float gain2 =
-            ramp_active ? ramp_start[2] + (gains[2] - ramp_start[2]) * progress : gains[2];
-        const float gain3 =
-            ramp_active ? ramp_start[3] + (gains[3] - ramp_start[3]) * progress : gains[3];
-
-        // Conversion from stereo (current_frame) to quadraphonic (dest) occurs here.
-        dest[samplei][0] += static_cast<s32>(gain0 * current_frame[samplei][0]);
-        dest[samplei][1] += static_cast<s32>(gain1 * current_frame[samplei][1]);
-        dest[samplei][2] += static_cast<s32>(gain2 * current_frame[samplei][0]);
-        dest[samplei][3] += static_cast<s32>(gain3 * current_frame[samplei][1]);
+    const auto is_silent = [](const std::array<float, 4>& g) {
+        return std::all_of(g.begin(), g.end(), [](float gain) { return gain == 0.0f; });
+    };
+
+    // Conversion from stereo (current_frame) to quadraphonic (dest) occurs here.
+    if (!ramp_active) {
+        // Most sources only feed one of the intermediate mixes, skip the others entirely.
+        if (is_silent(gains)) {
+            return;
+        }
+        // Kept apart from the ramping loop below so that it can be vectorized.
+        for (std::size_t samplei = 0; samplei < samples_per_frame; samplei++) {
+            dest[samplei][0] += static_cast<s32>(gains[0] * current_frame[samplei][0]);
+            dest[samplei][1] += static_cast<s32>(gains[1] * current_frame[samplei][1]);
+            dest[samplei][2] += static_cast<s32>(gains[2] * current_frame[samplei][0]);
+            dest[samplei][3] += static_cast<s32>(gains[3] * current_frame[samplei][1]);
+        }
+        return;
     }
 
-    if (ramp_active) {
-        state.gain_ramp_start.at(intermediate_mix_id) = gains;
-        state.gain_ramp_active.at(intermediate_mix_id) = false;
+    if (!is_silent(gains) || !is_silent(ramp_start)) {
+        for (std::size_t samplei = 0; samplei < samples_per_frame; samplei++) {
+            const float progress = static_cast<float>(samplei) * ramp_scale;
+            const float gain0 = ramp_start[0] + (gains[0] - ramp_start[0]) * progress;
+            const float gain1 = ramp_start[1] + (gains[1] - ramp_start[1]) * progress;
+            const float gain2 = ramp_start[2] + (gains[2] - ramp_start[2]) * progress;
+            const float gain3 = ramp_start[3] + (gains[3] - ramp_start[3]) * progress;
+
+            dest[samplei][0] += static_cast<s32>(gain0 * current_frame[samplei][0]);
+            dest[samplei][1] += static_cast<s32>(gain1 * current_frame[samplei][1]);
+            dest[samplei][2] += static_cast<s32>(gain2 * current_frame[samplei][0]);
+            dest[samplei][3] += static_cast<s32>(gain3 * current_frame[samplei][1]);
+        }
     }
+
+    state.gain_ramp_start.at(intermediate_mix_id) = gains;
+    state.gain_ramp_active.at(intermediate_mix_id) = false;
 }
 
 void Source::Reset() {
@@ -233,19 +249,18 @@ void Source::ParseConfig(SourceConfiguration::Configuration& config,
                 // TODO(xperia64): This may just work fine like PCM16, but I haven't tested and
                 // couldn't find any test case games
                 UNIMPLEMENTED_MSG("{} not handled for partial buffer updates", "PCM8");
-                // state.current_buffer = Codec::DecodePCM8(num_channels, memory, config.length);
+                // Codec::DecodePCM8(num_channels, memory, config.length, state.current_buffer);
                 break;
             case Format::PCM16:
-                state.current_buffer = Codec::DecodePCM16(num_channels, memory, config.length);
+                Codec::DecodePCM16(num_channels, memory, config.length, state.current_buffer);
                 valid = true;
                 break;
             case Format::ADPCM:
                 // TODO(xperia64): Are partial embedded buffer updates even valid for ADPCM? What
                 // about the adpcm state?
                 UNIMPLEMENTED_MSG("{} not handled for partial buffer updates", "ADPCM");
-                /* state.current_buffer =
-                    Codec::DecodeADPCM(memory, config.length, state.adpcm_coeffs,
-                   state.adpcm_state); */
+                /* Codec::DecodeADPCM(memory, config.length, state.adpcm_coeffs,
+                   state.adpcm_state, state.current_buffer); */
                 break;
             default:
                 UNIMPLEMENTED();
@@ -264,9 +279,7 @@ void Source::ParseConfig(SourceConfiguration::Configuration& config,
                 if (state.current_buffer.size() < state.current_sample_number) {
                     state.current_sample_number = 0;
                 } else {
-                    state.current_buffer.erase(
-                        state.current_buffer.begin(),
-                        std::next(state.current_buffer.begin(), state.current_sample_number));
+                    state.current_buffer.PopFront(state.current_sample_number);
                 }
             }
         }
@@ -390,9 +403,15 @@ void Source::GenerateFrame() {
                                 current_frame, frame_position);
             break;
         case InterpolationMode::Polyphase:
-            // TODO(merry): Implement polyphase interpolation
-            AudioInterp::Linear(state.interp_state, state.current_buffer, state.rate_multiplier,
-                                current_frame, frame_position);
+            // The filter banks of the firmware haven't been matched yet, so the approximation is
+            // opt-in.
+            if (Settings::values.enable_polyphase_interpolation.GetValue()) {
+                AudioInterp::Polyphase(state.interp_state, state.current_buffer,
+                                       state.rate_multiplier, current_frame, frame_position);
+            } else {
+                AudioInterp::Linear(state.interp_state, state.current_buffer,
+                                    state.rate_multiplier, current_frame, frame_position);
+            }
             break;
         default:
             UNIMPLEMENTED();
@@ -428,15 +447,15 @@ bool Source::DequeueBuffer() {
         const unsigned num_channels = buf.mono_or_stereo == MonoOrStereo::Stereo ? 2 : 1;
         switch (buf.format) {
         case Format::PCM8:
-            state.current_buffer = Codec::DecodePCM8(num_channels, memory, buf.length);
+            Codec::DecodePCM8(num_channels, memory, buf.length, state.current_buffer);
             break;
         case Format::PCM16:
-            state.current_buffer = Codec::DecodePCM16(num_channels, memory, buf.length);
+            Codec::DecodePCM16(num_channels, memory, buf.length, state.current_buffer);
             break;
         case Format::ADPCM:
             DEBUG_ASSERT(num_channels == 1);
-            state.current_buffer =
-                Codec::DecodeADPCM(memory, buf.length, state.adpcm_coeffs, state.adpcm_state);
+            Codec::DecodeADPCM(memory, buf.length, state.adpcm_coeffs, state.adpcm_state,
+                               state.current_buffer);
             break;
         default:
             UNIMPLEMENTED();
@@ -464,9 +483,7 @@ bool Source::DequeueBuffer() {
 
     // Because our interpolation consumes samples instead of using an index,
     // let's just consume the samples up to the current sample number.
-    state.current_buffer.erase(
-        state.current_buffer.begin(),
-        std::next(state.current_buffer.begin(), state.current_sample_number));
+    state.current_buffer.PopFront(state.current_sample_number);
 
     LOG_TRACE(Audio_DSP,
               "source_id={} buffer_id={} from_queue={} current_buffer.size()={}, "
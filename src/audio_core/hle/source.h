@@ -7,7 +7,6 @@
 #include <array>
 #include <vector>
 #include <boost/serialization/array.hpp>
-#include <boost/serialization/deque.hpp>
 #include <boost/serialization/priority_queue.hpp>
 #include <boost/serialization/vector.hpp>
 #include <queue>
@@ -67,6 +66,11 @@ public:
      */
     void MixInto(QuadFrame32& dest, std::size_t intermediate_mix_id);
 
+    /// Returns whether this source is currently playing.
+    bool IsEnabled() const {
+        return state.enabled;
+    }
+
 private:
     const std::size_t source_id;
     Memory::MemorySystem* memory_system{};
@@ -3,9 +3,21 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numbers>
 #include "audio_core/interpolate.h"
 #include "common/assert.h"
 
+#if defined(CITRA_HAS_SSE42)
+#include <emmintrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(__ARM_NEON)
+#define CITRA_HAS_NEON
+#include <arm_neon.h>
+#endif
+
 namespace AudioCore::AudioInterp {
 
 // Calculations are done in fixed point with 24 fractional bits.
@@ -23,7 +35,8 @@ static void StepOverSamples(State& state, StereoBuffer16& input, float rate, Ste
     if (input.empty())
         return;
 
-    input.insert(input.begin(), {state.xn2, state.xn1});
+    const std::array<StereoBuffer16::Sample, 2> history{state.xn2, state.xn1};
+    input.PushFront(history);
 
     const u64 step_size = static_cast<u64>(rate * scale_factor);
     u64 fposition = state.fposition;
@@ -47,7 +60,7 @@ static void StepOverSamples(State& state, StereoBuffer16& input, float rate, Ste
     state.xn1 = input[inputi + 1];
     state.fposition = fposition - inputi * scale_factor;
 
-    input.erase(input.begin(), std::next(input.begin(), inputi + 2));
+    input.PopFront(inputi + 2);
 }
 
 void None(State& state, StereoBuffer16& input, float rate, StereoFrame16& output,
@@ -73,4 +86,177 @@ void Linear(State& state, StereoBuffer16& input, float rate, StereoFrame16& outp
                     });
 }
 
+namespace {
+
+constexpr std::size_t polyphase_phases = 128;
+constexpr u64 polyphase_phase_shift = 17;
+static_assert(scale_factor >> polyphase_phase_shift == polyphase_phases);
+
+/// Coefficients are fixed point with 14 bits fractional part.
+constexpr int polyphase_coeff_bits = 14;
+
+/// Largest rate of each range of rates sharing a coefficient bank. Faster rates use the last bank.
+constexpr std::array<float, 5> polyphase_bank_rates{1.0f, 1.25f, 1.5f, 2.0f, 3.0f};
+
+using PolyphaseCoeffs = std::array<s16, polyphase_taps>;
+using PolyphaseBank = std::array<PolyphaseCoeffs, polyphase_phases>;
+
+/// Zeroth order modified Bessel function of the first kind, used by the Kaiser window.
+double BesselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 32; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+PolyphaseBank MakePolyphaseBank(double rate) {
+    constexpr double kaiser_beta = 5.0;
+    constexpr double half_width = polyphase_taps / 2.0;
+    constexpr std::size_t center_tap = polyphase_taps / 2 - 1;
+
+    // Upsampling keeps the whole input band, decimation moves the cutoff down to the Nyquist
+    // frequency of the output.
+    const double cutoff = 1.0 / std::max(1.0, rate);
+
+    PolyphaseBank bank{};
+    for (std::size_t phase = 0; phase < polyphase_phases; phase++) {
+        const double fraction = static_cast<double>(phase) / polyphase_phases;
+
+        std::array<double, polyphase_taps> taps{};
+        double sum = 0.0;
+        for (std::size_t k = 0; k < polyphase_taps; k++) {
+            const double distance = static_cast<double>(k) - center_tap - fraction;
+            const double x = distance / half_width;
+            const double window =
+                x * x < 1.0 ? BesselI0(kaiser_beta * std::sqrt(1.0 - x * x)) / BesselI0(kaiser_beta)
+                            : 0.0;
+            const double t = std::numbers::pi * cutoff * distance;
+            taps[k] = (t == 0.0 ? 1.0 : std::sin(t) / t) * window;
+            sum += taps[k];
+        }
+
+        // Normalize to unity gain at DC, putting the rounding error on the largest tap. This also
+        // makes phase 0 of the full band filter pass the input through unchanged.
+        int total = 0;
+        std::size_t largest = 0;
+        for (std::size_t k = 0; k < polyphase_taps; k++) {
+            const int coeff =
+                static_cast<int>(std::lround(taps[k] / sum * (1 << polyphase_coeff_bits)));
+            bank[phase][k] = static_cast<s16>(coeff);
+            total += coeff;
+            if (std::abs(taps[k]) > std::abs(taps[largest])) {
+                largest = k;
+            }
+        }
+        bank[phase][largest] += static_cast<s16>((1 << polyphase_coeff_bits) - total);
+    }
+    return bank;
+}
+
+const PolyphaseBank& GetPolyphaseBank(float rate) {
+    static const auto banks = [] {
+        std::array<PolyphaseBank, polyphase_bank_rates.size()> ret;
+        for (std::size_t i = 0; i < ret.size(); i++) {
+            ret[i] = MakePolyphaseBank(polyphase_bank_rates[i]);
+        }
+        return ret;
+    }();
+
+    const auto it = std::find_if(polyphase_bank_rates.begin(), polyphase_bank_rates.end(),
+                                 [rate](float bank_rate) { return rate <= bank_rate; });
+    const std::size_t index = std::min<std::size_t>(
+        std::distance(polyphase_bank_rates.begin(), it), polyphase_bank_rates.size() - 1);
+    return banks[index];
+}
+
+/// Filters polyphase_taps consecutive samples, starting at x, with one phase of a bank.
+std::array<s16, 2> ApplyPolyphaseFilter(const StereoBuffer16::Sample* x,
+                                        const PolyphaseCoeffs& coeffs) {
+    static_assert(polyphase_taps == 8, "The vectorized filters process exactly eight taps");
+
+    std::array<s16, 2> ret;
+#if defined(CITRA_HAS_SSE42)
+    // Group the samples as {L0, L1, R0, R1, L2, L3, R2, R3} and the coefficients as
+    // {c0, c1, c0, c1, c2, c3, c2, c3}, so that madd sums adjacent taps of the same channel.
+    const auto group_channels = [](__m128i v) {
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 1, 2, 0));
+        return _mm_shufflehi_epi16(v, _MM_SHUFFLE(3, 1, 2, 0));
+    };
+    const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(coeffs.data()));
+    const __m128i x_lo = group_channels(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x)));
+    const __m128i x_hi = group_channels(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + 4)));
+    __m128i acc = _mm_add_epi32(_mm_madd_epi16(x_lo, _mm_unpacklo_epi32(c, c)),
+                                _mm_madd_epi16(x_hi, _mm_unpackhi_epi32(c, c)));
+    acc = _mm_add_epi32(acc, _mm_srli_si128(acc, 8));
+    acc = _mm_add_epi32(acc, _mm_set1_epi32(1 << (polyphase_coeff_bits - 1)));
+    acc = _mm_srai_epi32(acc, polyphase_coeff_bits);
+    const s32 packed = _mm_cvtsi128_si32(_mm_packs_epi32(acc, acc));
+    std::memcpy(ret.data(), &packed, sizeof(ret));
+#elif defined(CITRA_HAS_NEON)
+    const int16x8x2_t samples = vld2q_s16(x->data());
+    const int16x8_t c = vld1q_s16(coeffs.data());
+    int32x4_t left = vmull_s16(vget_low_s16(samples.val[0]), vget_low_s16(c));
+    left = vmlal_s16(left, vget_high_s16(samples.val[0]), vget_high_s16(c));
+    int32x4_t right = vmull_s16(vget_low_s16(samples.val[1]), vget_low_s16(c));
+    right = vmlal_s16(right, vget_high_s16(samples.val[1]), vget_high_s16(c));
+    const int32x2_t sums =
+        vpadd_s32(vpadd_s32(vget_low_s32(left), vget_high_s32(left)),
+                  vpadd_s32(vget_low_s32(right), vget_high_s32(right)));
+    const int16x4_t narrowed = vqrshrn_n_s32(vcombine_s32(sums, sums), polyphase_coeff_bits);
+    ret[0] = vget_lane_s16(narrowed, 0);
+    ret[1] = vget_lane_s16(narrowed, 1);
+#else
+    for (std::size_t channel = 0; channel < 2; channel++) {
+        s32 acc = 0;
+        for (std::size_t k = 0; k < polyphase_taps; k++) {
+            acc += x[k][channel] * coeffs[k];
+        }
+        acc = (acc + (1 << (polyphase_coeff_bits - 1))) >> polyphase_coeff_bits;
+        ret[channel] = static_cast<s16>(std::clamp(acc, -32768, 32767));
+    }
+#endif
+    return ret;
+}
+
+} // Anonymous namespace
+
+void Polyphase(State& state, StereoBuffer16& input, float rate, StereoFrame16& output,
+               std::size_t& outputi) {
+    ASSERT(rate > 0);
+
+    if (input.empty())
+        return;
+
+    constexpr std::size_t history_size = polyphase_taps - 1;
+    input.PushFront(state.polyphase_history);
+
+    const PolyphaseBank& bank = GetPolyphaseBank(rate);
+    const u64 step_size = static_cast<u64>(rate * scale_factor);
+    u64 fposition = state.fposition;
+    std::size_t inputi = 0;
+
+    while (outputi < output.size()) {
+        inputi = static_cast<std::size_t>(fposition / scale_factor);
+
+        if (inputi + history_size >= input.size()) {
+            inputi = input.size() - history_size;
+            break;
+        }
+
+        const std::size_t phase =
+            static_cast<std::size_t>((fposition & scale_mask) >> polyphase_phase_shift);
+        output[outputi++] = ApplyPolyphaseFilter(&input[inputi], bank[phase]);
+
+        fposition += step_size;
+    }
+
+    std::copy_n(&input[inputi], history_size, state.polyphase_history.begin());
+    state.fposition = fposition - inputi * scale_factor;
+
+    input.PopFront(inputi + history_size);
+}
+
 } // namespace AudioCore::AudioInterp
@@ -5,19 +5,24 @@
 #pragma once
 
 #include <array>
-#include <deque>
+#include <cstddef>
 #include "audio_core/audio_types.h"
+#include "audio_core/stereo_buffer.h"
 #include "common/common_types.h"
 
 namespace AudioCore::AudioInterp {
 
-/// A variable length buffer of signed PCM16 stereo samples.
-using StereoBuffer16 = std::deque<std::array<s16, 2>>;
+using StereoBuffer16 = AudioCore::StereoBuffer16;
+
+/// Length of the windowed-sinc filter used for polyphase interpolation.
+constexpr std::size_t polyphase_taps = 8;
 
 struct State {
     /// Two historical samples.
     std::array<s16, 2> xn1 = {}; ///< x[n-1]
     std::array<s16, 2> xn2 = {}; ///< x[n-2]
+    /// Historical samples for polyphase interpolation, oldest first.
+    std::array<std::array<s16, 2>, polyphase_taps - 1> polyphase_history = {};
     /// Current fractional position.
     u64 fposition = 0;
 };
@@ -46,4 +51,18 @@ void None(State& state, StereoBuffer16& input, float rate, StereoFrame16& output
 void Linear(State& state, StereoBuffer16& input, float rate, StereoFrame16& output,
             std::size_t& outputi);
 
+/**
+ * Polyphase windowed-sinc interpolation. The filter is picked from precomputed coefficient banks,
+ * one per range of rates, which lower the cutoff when decimating to avoid aliasing. There is a
+ * four-sample predelay.
+ * @param state Interpolation state.
+ * @param input Input buffer.
+ * @param rate Stretch factor. Must be a positive non-zero value.
+ *             rate > 1.0 performs decimation and rate < 1.0 performs upsampling.
+ * @param output The resampled audio buffer.
+ * @param outputi The index of output to start writing to.
+ */
+void Polyphase(State& state, StereoBuffer16& input, float rate, StereoFrame16& output,
+               std::size_t& outputi);
+
 } // namespace AudioCore::AudioInterp
@@ -2,19 +2,24 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <thread>
 #include <teakra/teakra.h>
 #include "audio_core/lle/lle.h"
 #include "common/assert.h"
 #include "common/bit_field.h"
+#include "common/microprofile.h"
 #include "common/swap.h"
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/service/dsp/dsp_dsp.h"
 
+MICROPROFILE_DEFINE(Audio_DSP_LLE, "Audio", "DSP LLE", MP_RGB(100, 100, 255));
+
 namespace AudioCore {
 
 enum class SegmentType : u8 {
@@ -150,10 +155,31 @@ struct DspLle::Impl final {
 
     static constexpr u32 DspDataOffset = 0x40000;
     static constexpr u32 TeakraSlice = 16384;
+    /// Largest number of slices run back to back while the DSP and the host leave each other alone.
+    static constexpr u32 MaxBatchSlices = 8;
+
+    /// Slices run by the next scheduled batch.
+    u32 batch_slices = 1;
+    /// Slices the DSP thread runs after the next barrier.
+    std::atomic<u32> thread_batch_slices = 1;
+    /// Set whenever the host or the DSP signal the other side, cleared by each scheduled batch.
+    std::atomic<bool> activity = false;
+
+    // Metrics, reset by GetAndResetMetrics
+    std::atomic<u64> cycles_run = 0;
+    std::atomic<u64> batches_run = 0;
+    std::atomic<u64> batched_slices = 0;
+    std::chrono::steady_clock::time_point metrics_start = std::chrono::steady_clock::now();
+
+    void RunCycles(u32 cycles) {
+        MICROPROFILE_SCOPE(Audio_DSP_LLE);
+        teakra.Run(cycles);
+        cycles_run.fetch_add(cycles, std::memory_order_relaxed);
+    }
 
     void TeakraThread() {
         while (true) {
-            teakra.Run(TeakraSlice);
+            RunCycles(TeakraSlice * thread_batch_slices.load());
             teakra_slice_barrier.Sync();
             if (stop_signal) {
                 if (stop_generation == teakra_slice_barrier.Generation())
@@ -172,17 +198,42 @@ struct DspLle::Impl final {
         }
     }
 
-    void RunTeakraSlice() {
+    /// Runs the given number of slices. In multithreaded mode, this waits for the slices the DSP
+    /// thread is running and then lets it start this many.
+    void RunTeakraSlices(u32 slices) {
         if (multithread) {
+            thread_batch_slices = slices;
             teakra_slice_barrier.Sync();
         } else {
-            teakra.Run(TeakraSlice);
+            RunCycles(TeakraSlice * slices);
         }
     }
 
+    /// Runs a single slice, used when the host is waiting on the DSP.
+    void RunTeakraSlice() {
+        activity = true;
+        RunTeakraSlices(1);
+    }
+
+    /// Picks the size of the next batch. Batches grow while neither side signals the other, as
+    /// nothing depends on how closely the DSP follows the ARM11 then, and shrink back to a single
+    /// slice as soon as one does.
+    u32 NextBatchSlices() {
+        if (activity.exchange(false)) {
+            batch_slices = 1;
+        } else {
+            batch_slices = std::min(batch_slices * 2, MaxBatchSlices);
+        }
+        return batch_slices;
+    }
+
     void TeakraSliceEvent(u64 late) {
-        RunTeakraSlice();
-        u64 next = TeakraSlice * 2; // DSP runs at clock rate half of the CPU rate
+        const u32 slices = NextBatchSlices();
+        RunTeakraSlices(slices);
+        batches_run.fetch_add(1, std::memory_order_relaxed);
+        batched_slices.fetch_add(slices, std::memory_order_relaxed);
+
+        u64 next = TeakraSlice * 2 * slices; // DSP runs at clock rate half of the CPU rate
         if (next < late)
             next = 0;
         else
@@ -222,6 +273,7 @@ struct DspLle::Impl final {
     }
 
     void WritePipe(u8 pipe_index, std::span<const u8> data) {
+        activity = true;
         PipeStatus pipe_status = GetPipeStatus(pipe_index, PipeDirection::CPUtoDSP);
         bool need_update = false;
         const u8* buffer_ptr = data.data();
@@ -260,6 +312,7 @@ struct DspLle::Impl final {
     }
 
     std::vector<u8> ReadPipe(u8 pipe_index, u16 bsize) {
+        activity = true;
         PipeStatus pipe_status = GetPipeStatus(pipe_index, PipeDirection::DSPtoCPU);
         bool need_update = false;
         std::vector<u8> data(bsize);
@@ -312,6 +365,8 @@ struct DspLle::Impl final {
         }
 
         teakra.Reset();
+        batch_slices = 1;
+        thread_batch_slices = 1;
 
         Dsp1 dsp(buffer);
         auto dsp_memory = teakra.GetDspMemory();
@@ -379,6 +434,7 @@ struct DspLle::Impl final {
 };
 
 u16 DspLle::RecvData(u32 register_number) {
+    impl->activity = true;
     while (!impl->teakra.RecvDataIsReady(register_number)) {
         impl->RunTeakraSlice();
     }
@@ -390,6 +446,7 @@ bool DspLle::RecvDataIsReady(u32 register_number) const {
 }
 
 void DspLle::SetSemaphore(u16 semaphore_value) {
+    impl->activity = true;
     impl->teakra.SetSemaphore(semaphore_value);
 }
 
@@ -411,12 +468,14 @@ void DspLle::SetInterruptHandler(
         if (!impl->loaded) {
             return;
         }
+        impl->activity = true;
         handler(Service::DSP::InterruptType::Zero, static_cast<DspPipe>(0));
     });
     impl->teakra.SetRecvDataHandler(1, [this, handler]() {
         if (!impl->loaded) {
             return;
         }
+        impl->activity = true;
         handler(Service::DSP::InterruptType::One, static_cast<DspPipe>(0));
     });
 
@@ -424,6 +483,7 @@ void DspLle::SetInterruptHandler(
         if (!impl->loaded)
             return;
 
+        impl->activity = true;
         auto& teakra = impl->teakra;
         if (event_from_data) {
             impl->data_signaled = true;
@@ -454,6 +514,25 @@ void DspLle::SetInterruptHandler(
     impl->teakra.SetSemaphoreHandler([ProcessPipeEvent]() { ProcessPipeEvent(false); });
 }
 
+DspLle::Metrics DspLle::GetAndResetMetrics() {
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> interval = now - impl->metrics_start;
+    impl->metrics_start = now;
+
+    const u64 cycles = impl->cycles_run.exchange(0, std::memory_order_relaxed);
+    const u64 batches = impl->batches_run.exchange(0, std::memory_order_relaxed);
+    const u64 slices = impl->batched_slices.exchange(0, std::memory_order_relaxed);
+
+    Metrics metrics{};
+    if (interval.count() > 0.0) {
+        metrics.cycles_per_second = static_cast<double>(cycles) / interval.count();
+    }
+    if (batches > 0) {
+        metrics.average_batch_slices = static_cast<double>(slices) / static_cast<double>(batches);
+    }
+    return metrics;
+}
+
 void DspLle::LoadComponent(std::span<const u8> buffer) {
     impl->LoadComponent(buffer);
 }
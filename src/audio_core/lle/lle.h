@@ -37,6 +37,16 @@ public:
     void LoadComponent(const std::span<const u8> buffer) override;
     void UnloadComponent() override;
 
+    struct Metrics {
+        /// DSP cycles emulated per second of host time.
+        double cycles_per_second;
+        /// Average number of slices run by each scheduled batch.
+        double average_batch_slices;
+    };
+
+    /// Returns the metrics gathered since the previous call. Not thread-safe with itself.
+    Metrics GetAndResetMetrics();
+
 private:
     struct Impl;
     std::unique_ptr<Impl> impl;
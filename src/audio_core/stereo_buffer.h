@@ -0,0 +1,103 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+#include <boost/serialization/array.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/vector.hpp>
+#include "common/assert.h"
+#include "common/common_types.h"
+
+namespace AudioCore {
+
+/**
+ * A variable length buffer of signed PCM16 stereo samples, consumed from the front.
+ * Consuming samples only moves the read position, and the storage is kept when the buffer is
+ * refilled, so a source stops allocating once its buffer has grown to the largest it decodes.
+ */
+class StereoBuffer16 {
+public:
+    using Sample = std::array<s16, 2>;
+
+    std::size_t size() const {
+        return samples.size() - start;
+    }
+
+    bool empty() const {
+        return start == samples.size();
+    }
+
+    Sample& operator[](std::size_t i) {
+        return samples[start + i];
+    }
+
+    const Sample& operator[](std::size_t i) const {
+        return samples[start + i];
+    }
+
+    void clear() {
+        samples.clear();
+        start = 0;
+    }
+
+    /**
+     * Discards the contents of the buffer and makes room for `count` new samples.
+     * @return Storage for the new samples, which must all be written by the caller.
+     */
+    std::span<Sample> Reset(std::size_t count) {
+        samples.resize(front_space + count);
+        start = front_space;
+        return {samples.data() + start, count};
+    }
+
+    /// Removes `count` samples from the front of the buffer.
+    void PopFront(std::size_t count) {
+        ASSERT(count <= size());
+        start += count;
+        if (start == samples.size()) {
+            clear();
+        }
+    }
+
+    /// Inserts samples at the front of the buffer, keeping their order.
+    void PushFront(std::span<const Sample> history) {
+        if (start < history.size()) {
+            const std::size_t grow = std::max(front_space, history.size()) - start;
+            samples.insert(samples.begin(), grow, Sample{});
+            start += grow;
+        }
+        start -= history.size();
+        std::copy(history.begin(), history.end(), samples.begin() + start);
+    }
+
+private:
+    /// Room kept in front of freshly decoded samples for the interpolators' history.
+    static constexpr std::size_t front_space = 8;
+
+    std::vector<Sample> samples;
+    std::size_t start = 0;
+
+    template <class Archive>
+    void save(Archive& ar, const unsigned int) const {
+        const std::vector<Sample> remaining(samples.begin() + start, samples.end());
+        ar << remaining;
+    }
+
+    template <class Archive>
+    void load(Archive& ar, const unsigned int) {
+        ar >> samples;
+        start = 0;
+    }
+
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+    friend class boost::serialization::access;
+};
+
+} // namespace AudioCore
@@ -18,7 +18,16 @@
 
 namespace AudioCore {
 
-TimeStretcher::TimeStretcher() : sound_touch(std::make_unique<soundtouch::SoundTouch>()) {
+/// The buffers only grow, so that the audio callback stops allocating once they fit its largest
+/// request.
+struct TimeStretcher::ConversionBuffers {
+    std::vector<soundtouch::SAMPLETYPE> float_in;
+    std::vector<soundtouch::SAMPLETYPE> float_out;
+};
+
+TimeStretcher::TimeStretcher()
+    : sound_touch(std::make_unique<soundtouch::SoundTouch>()),
+      buffers(std::make_unique<ConversionBuffers>()) {
     sound_touch->setChannels(2);
     sound_touch->setSampleRate(native_sample_rate);
     sound_touch->setPitch(1.0);
@@ -67,9 +76,11 @@ std::size_t TimeStretcher::Process(const s16* in, std::size_t num_in, s16* out,
 
     if constexpr (std::is_floating_point<soundtouch::SAMPLETYPE>()) {
         // The SoundTouch library on most systems expects float samples
-        // use this vector to store input if soundtouch::SAMPLETYPE is a float
-        std::vector<soundtouch::SAMPLETYPE> float_in(2 * num_in);
-        std::vector<soundtouch::SAMPLETYPE> float_out(2 * num_out);
+        // use these buffers to store input if soundtouch::SAMPLETYPE is a float
+        auto& float_in = buffers->float_in;
+        auto& float_out = buffers->float_out;
+        float_in.resize(std::max(float_in.size(), 2 * num_in));
+        float_out.resize(std::max(float_out.size(), 2 * num_out));
 
         for (std::size_t i = 0; i < (2 * num_in); i++) {
             // Conventional integer PCM uses a range of -32768 to 32767,
@@ -85,7 +96,7 @@ std::size_t TimeStretcher::Process(const s16* in, std::size_t num_in, s16* out,
             sound_touch->receiveSamples(float_out.data(), static_cast<u32>(num_out));
 
         // Converting output samples back to shorts so we can use them
-        for (std::size_t i = 0; i < (2 * num_out); i++) {
+        for (std::size_t i = 0; i < (2 * samples_received); i++) {
             const s16 temp = static_cast<s16>(float_out[i] * std::numeric_limits<s16>::max());
             out[i] = temp;
         }
@@ -36,6 +36,10 @@ public:
 private:
     std::unique_ptr<soundtouch::SoundTouch> sound_touch;
     double stretch_ratio = 1.0;
+    /// Conversion buffers for SoundTouch builds using float samples. They are defined next to the
+    /// SoundTouch include, since soundtouch::SAMPLETYPE isn't visible to users of this header.
+    struct ConversionBuffers;
+    std::unique_ptr<ConversionBuffers> buffers;
 };
 
 } // namespace AudioCore
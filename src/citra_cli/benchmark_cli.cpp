@@ -0,0 +1,180 @@
+// Copyright 2026 Citra Emulator Project / Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <json.hpp>
+#undef _UNICODE
+#include <getopt.h>
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+#include "audio_core/lle/lle.h"
+#include "citra_cli/benchmark_cli.h"
+#include "citra_cli/citra_cli.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "core/3ds.h"
+#include "core/core.h"
+#include "core/frontend/emu_window.h"
+#include "core/movie.h"
+#include "video_core/gpu.h"
+#include "video_core/renderer_base.h"
+
+namespace CitraCLI {
+
+namespace {
+
+/// An EmuWindow without any window system behind it, for renderers which don't present.
+class EmuWindow_Headless final : public Frontend::EmuWindow {
+public:
+    EmuWindow_Headless() {
+        window_info.type = Frontend::WindowSystemType::Headless;
+        UpdateCurrentFramebufferLayout(Core::kScreenTopWidth,
+                                       Core::kScreenTopHeight + Core::kScreenBottomHeight);
+    }
+
+    void PollEvents() override {}
+};
+
+} // Anonymous namespace
+
+int ParseBenchmarkCommand(int argc, char* argv[]) {
+    Common::Log::Initialize();
+    Common::Log::Start();
+
+    std::optional<std::string> title_path; // The path of the application to benchmark
+    std::optional<std::string> movie_path; // The path of a movie to replay while benchmarking
+    std::optional<u64> num_frames;         // The number of frames to run for
+    Settings::GraphicsAPI graphics_api = Settings::GraphicsAPI::Software;
+
+    int option;
+    while ((option = getopt(argc, argv, benchmark_ops_optstring)) != -1) {
+        switch (option) {
+        case 'b':
+            title_path = optarg;
+            break;
+        case 'n':
+            num_frames = std::strtoull(optarg, nullptr, 10);
+            break;
+        case 'p':
+            movie_path = optarg;
+            break;
+        case 'r':
+            if (std::string_view{optarg} == "null") {
+                graphics_api = Settings::GraphicsAPI::Null;
+            } else if (std::string_view{optarg} != "software") {
+                std::cerr << "Unknown renderer '" << optarg << "'. Quitting." << std::endl;
+                return 1;
+            }
+            break;
+        }
+    }
+
+    if (!title_path.has_value() || (!num_frames.has_value() && !movie_path.has_value())) {
+        std::cerr << "A frame count or a movie to replay must be provided. Quitting." << std::endl;
+        return 1;
+    }
+
+    // Run unthrottled on a renderer which needs neither a GPU nor a display.
+    Settings::values.graphics_api = graphics_api;
+    Settings::values.frame_limit = 0;
+    Settings::values.output_type = AudioCore::SinkType::Null;
+    Settings::values.input_type = AudioCore::InputType::Null;
+
+    Core::System& system = Core::System::GetInstance();
+    Core::Movie& movie = system.Movie();
+    if (movie_path.has_value()) {
+        movie.PrepareForPlayback(*movie_path);
+    }
+
+    EmuWindow_Headless emu_window;
+    const Core::System::ResultStatus load_result = system.Load(emu_window, *title_path);
+    if (load_result != Core::System::ResultStatus::Success) {
+        std::cerr << "Failed to load '" << *title_path << "' (error "
+                  << static_cast<u32>(load_result) << "). Check log for more details."
+                  << std::endl;
+        return 1;
+    }
+
+    bool movie_finished = false;
+    if (movie_path.has_value()) {
+        if (movie.ValidateMovie(*movie_path) != Core::Movie::ValidationResult::OK) {
+            LOG_WARNING(Frontend, "Movie '{}' may not match this application", *movie_path);
+        }
+        movie.SetPlaybackCompletionCallback([&movie_finished] { movie_finished = true; });
+        movie.StartPlayback(*movie_path);
+    }
+
+    const VideoCore::RendererBase& renderer = system.GPU().Renderer();
+    const s32 start_frame = renderer.GetCurrentFrame();
+    const auto frames_run = [&] {
+        return static_cast<u64>(renderer.GetCurrentFrame() - start_frame);
+    };
+
+    // The LLE DSP gathers metrics of its own.
+    auto* const dsp_lle = dynamic_cast<AudioCore::DspLle*>(&system.DSP());
+
+    [[maybe_unused]] const auto discarded_stats = system.GetAndResetPerfStats();
+    if (dsp_lle) {
+        [[maybe_unused]] const auto discarded_dsp_metrics = dsp_lle->GetAndResetMetrics();
+    }
+    const auto start_time = std::chrono::steady_clock::now();
+
+    Core::System::ResultStatus result = Core::System::ResultStatus::Success;
+    while (result == Core::System::ResultStatus::Success && !movie_finished &&
+           (!num_frames.has_value() || frames_run() < *num_frames)) {
+        result = system.RunLoop();
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    const Core::PerfStats::Results stats = system.GetAndResetPerfStats();
+    const double mean_frametime = system.perf_stats->GetMeanFrametime();
+    const u64 frames = frames_run();
+    std::optional<AudioCore::DspLle::Metrics> dsp_metrics;
+    if (dsp_lle) {
+        dsp_metrics = dsp_lle->GetAndResetMetrics();
+    }
+
+    movie.Shutdown();
+    system.Shutdown();
+
+    if (result != Core::System::ResultStatus::Success) {
+        LOG_ERROR(Frontend, "Emulation stopped early (error {})", static_cast<u32>(result));
+    }
+
+    // Per-frame timings are reported in milliseconds.
+    nlohmann::ordered_json json;
+    json["title"] = *title_path;
+    json["movie"] = movie_path.value_or("");
+    json["renderer"] = graphics_api == Settings::GraphicsAPI::Null ? "null" : "software";
+    json["frames"] = frames;
+    json["completed"] = result == Core::System::ResultStatus::Success &&
+                        (!num_frames.has_value() || frames >= *num_frames);
+    json["wall_time_s"] = elapsed.count();
+    json["system_fps"] = stats.system_fps;
+    json["game_fps"] = stats.game_fps;
+    json["emulation_speed"] = stats.emulation_speed;
+    json["mean_frametime_ms"] = mean_frametime;
+    json["time_vblank_interval_ms"] = stats.time_vblank_interval * 1000.0;
+    json["time_hle_svc_ms"] = stats.time_hle_svc * 1000.0;
+    json["time_hle_ipc_ms"] = stats.time_hle_ipc * 1000.0;
+    json["time_gpu_ms"] = stats.time_gpu * 1000.0;
+    json["time_swap_ms"] = stats.time_swap * 1000.0;
+    json["time_remaining_ms"] = stats.time_remaining * 1000.0;
+    if (dsp_metrics) {
+        json["dsp_cycles_per_second"] = dsp_metrics->cycles_per_second;
+        json["dsp_average_batch_slices"] = dsp_metrics->average_batch_slices;
+    }
+    std::cout << json.dump(4) << std::endl;
+
+    return json["completed"].get<bool>() ? 0 : 1;
+}
+
+} // namespace CitraCLI
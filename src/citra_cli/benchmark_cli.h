@@ -0,0 +1,9 @@
+// Copyright 2026 Citra Emulator Project / Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+namespace CitraCLI {
+
+int ParseBenchmarkCommand(int argc, char* argv[]);
+
+}
@@ -8,8 +8,10 @@
 #include <unistd.h>
 #endif
 
+#include "citra_cli/benchmark_cli.h"
 #include "citra_cli/citra_cli.h"
 #include "citra_cli/compression_cli.h"
+#include "citra_cli/shader_cache_cli.h"
 
 namespace CitraCLI {
 
@@ -37,9 +39,16 @@ bool CheckForOptions(const char* optstring, int argc, char* argv[]) {
 }
 
 int ParseCommand(int argc, char* argv[]) {
-    if (CheckForOptions(compression_ops_optstring, argc, argv)) {
+    if (CheckForOptions(compression_trigger_optstring, argc, argv)) {
         return ParseCompressionCommand(argc, argv);
     }
+    if (CheckForOptions(benchmark_trigger_optstring, argc, argv)) {
+        return ParseBenchmarkCommand(argc, argv);
+    }
+    if (CheckForOptions(shader_cache_trigger_optstring, argc, argv)) {
+        return ParseShaderCacheCommand(argc, argv);
+    }
+    return 1;
 }
 
 } // namespace CitraCLI
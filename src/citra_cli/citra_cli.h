@@ -4,8 +4,13 @@
 
 namespace CitraCLI {
 
+constexpr char compression_trigger_optstring[] = "c:x:";
 constexpr char compression_ops_optstring[] = "c:x:o:";
-constexpr char cli_capture_optstring[] = "c:x:o:";
+constexpr char benchmark_trigger_optstring[] = "b:";
+constexpr char benchmark_ops_optstring[] = "b:n:p:r:";
+constexpr char shader_cache_trigger_optstring[] = "s:";
+constexpr char shader_cache_ops_optstring[] = "s:o:t:j:";
+constexpr char cli_capture_optstring[] = "c:x:o:b:s:";
 
 bool CheckForOptions(const char* optstring, int argc, char* argv[]);
 int ParseCommand(int argc, char* argv[]);
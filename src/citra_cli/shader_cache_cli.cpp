@@ -0,0 +1,122 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <fmt/format.h>
+#undef _UNICODE
+#include <getopt.h>
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+#include "citra_cli/citra_cli.h"
+#include "citra_cli/shader_cache_cli.h"
+#include "common/common_paths.h"
+#include "common/file_util.h"
+#include "common/logging/backend.h"
+#include "common/logging/log.h"
+#ifdef ENABLE_VULKAN
+#include "video_core/renderer_vulkan/vk_shader_disk_cache.h"
+#endif
+
+namespace CitraCLI {
+
+#ifdef ENABLE_VULKAN
+/// Collects the title IDs of the shader caches in a transferable cache directory.
+static std::set<u64> find_cached_titles(const std::string& dir) {
+    std::set<u64> title_ids;
+    FileUtil::ForeachDirectoryEntry(
+        nullptr, dir, [&](u64*, const std::string&, const std::string& virtual_name) {
+            // Cache files are named {title_id:016X}_{type}.vkch
+            if (virtual_name.size() == 16 + 8 && virtual_name.ends_with(".vkch") &&
+                virtual_name[16] == '_') {
+                char* end;
+                const u64 title_id = std::strtoull(virtual_name.substr(0, 16).c_str(), &end, 16);
+                if (*end == '\0') {
+                    title_ids.insert(title_id);
+                }
+            }
+            return true;
+        });
+    return title_ids;
+}
+#endif
+
+int ParseShaderCacheCommand(int argc, char* argv[]) {
+    Common::Log::Initialize();
+    Common::Log::Start();
+
+#ifdef ENABLE_VULKAN
+    std::optional<std::string> source_dir; // The transferable cache directory to build from
+    std::optional<std::string> output_dir; // The directory receiving the rebuilt caches
+    std::optional<u64> only_title_id;      // The title to build, all titles if not set
+    std::size_t num_threads = std::max(std::thread::hardware_concurrency(), 1U);
+
+    int option;
+    while ((option = getopt(argc, argv, shader_cache_ops_optstring)) != -1) {
+        switch (option) {
+        case 's':
+            source_dir = optarg;
+            break;
+        case 'o':
+            output_dir = optarg;
+            break;
+        case 't':
+            only_title_id = std::strtoull(optarg, nullptr, 16);
+            break;
+        case 'j':
+            num_threads = std::strtoull(optarg, nullptr, 10);
+            break;
+        }
+    }
+
+    if (!source_dir.has_value()) {
+        std::cerr << "A shader cache directory must be provided. Quitting." << std::endl;
+        return 1;
+    }
+    if (!output_dir.has_value()) {
+        output_dir = source_dir;
+    }
+
+    std::set<u64> title_ids;
+    if (only_title_id.has_value()) {
+        title_ids.insert(*only_title_id);
+    } else {
+        title_ids = find_cached_titles(*source_dir);
+    }
+    if (title_ids.empty()) {
+        std::cerr << "No shader caches found in '" << *source_dir << "'. Quitting." << std::endl;
+        return 1;
+    }
+
+    bool success = true;
+    for (const u64 title_id : title_ids) {
+        std::cout << "Building shader cache for title " << fmt::format("{:016X}", title_id)
+                  << "..." << std::endl;
+        if (!Vulkan::ShaderDiskCache::BuildTransferableCache(title_id, *source_dir, *output_dir,
+                                                             num_threads)) {
+            std::cerr << "Failed to build shader cache for title "
+                      << fmt::format("{:016X}", title_id) << ". Check log for more details."
+                      << std::endl;
+            success = false;
+        }
+    }
+
+    if (success) {
+        std::cout << "Shader caches built successfully." << std::endl;
+    }
+    return success ? 0 : 1;
+#else
+    std::cerr << "This build does not include the Vulkan renderer. Quitting." << std::endl;
+    return 1;
+#endif
+}
+
+} // namespace CitraCLI
@@ -0,0 +1,9 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+namespace CitraCLI {
+
+int ParseShaderCacheCommand(int argc, char* argv[]);
+
+}
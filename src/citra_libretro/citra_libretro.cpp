@@ -614,6 +614,9 @@ bool retro_load_game(const struct retro_game_info* info) {
             return false;
         break;
     }
+    case Settings::GraphicsAPI::Null:
+        LibRetro::DisplayMessage("The null renderer is not supported by this core.");
+        return false;
     }
 
     uint64_t quirks =
@@ -112,6 +112,8 @@ MouseTracker::MouseTracker() {
     case Settings::GraphicsAPI::Software:
         cursor_renderer = std::make_unique<SoftwareCursorRenderer>();
         break;
+    case Settings::GraphicsAPI::Null:
+        break;
     }
 
     last_moved = std::chrono::steady_clock::time_point::min();
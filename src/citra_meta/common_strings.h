@@ -10,6 +10,10 @@ namespace Common {
 
 constexpr char help_string[] =
     "Usage: {} [options] <file path>\n"
+    "-b  [path]                  Run the application at the given path headless and unthrottled,\n"
+    "                              printing performance statistics as JSON (provide '-n [frames]'\n"
+    "                              to set the frame count and/or '-p [path]' to replay a movie,\n"
+    "                              and optionally '-r null' to skip rendering entirely)\n"
     "-c  [path]                  Z3DS compress a ROM located at the given path\n"
     "                              (optionally provide '-o [path]' for output directory)\n"
     "-d, --dump-video [path]     Dump video recording of emulator playback to the given file path\n"
@@ -19,6 +23,10 @@ constexpr char help_string[] =
     "-i, --install [path]        Install a CIA file at the given path\n"
     "-p, --movie-play [path]     Play a TAS movie located at the given path\n"
     "-r, --movie-record [path]   Record a TAS movie to the given file path\n"
+    "-s  [path]                  Rebuild the Vulkan shader caches in the given transferable cache\n"
+    "                              directory without a GPU (optionally provide '-o [path]' for\n"
+    "                              output directory, '-t [title id]' to only build one title and\n"
+    "                              '-j [threads]' for the number of threads)\n"
     "-a, --movie-record-author [author]   Set the author for the recorded TAS movie (to be used "
     "alongside --movie-record)\n"
 #ifdef ENABLE_ROOM
@@ -667,6 +667,9 @@ bool GRenderWindow::InitRenderTarget() {
         InitializeVulkan();
         break;
 #endif
+    case Settings::GraphicsAPI::Null:
+        InitializeNull();
+        break;
     default:
         LOG_CRITICAL(Frontend,
                      "Unknown or unsupported graphics API {}, falling back to available default",
@@ -680,8 +683,7 @@ bool GRenderWindow::InitRenderTarget() {
 #elif ENABLE_SOFTWARE_RENDERER
         InitializeSoftware();
 #else
-// TODO: Add a null renderer backend for this, perhaps.
-#error "At least one renderer must be enabled."
+        InitializeNull();
 #endif
         break;
     }
@@ -821,6 +823,12 @@ void GRenderWindow::InitializeSoftware() {
 }
 #endif
 
+void GRenderWindow::InitializeNull() {
+    // The null renderer never presents, so the widget only reserves the render area.
+    child_widget = new RenderWidget(this);
+    main_context = std::make_unique<DummyContext>();
+}
+
 void GRenderWindow::OnEmulationStarting(EmuThread* emu_thread) {
     this->emu_thread = emu_thread;
 }
@@ -200,6 +200,7 @@ private:
 #ifdef ENABLE_SOFTWARE_RENDERER
     void InitializeSoftware();
 #endif
+    void InitializeNull();
 
     QWidget* child_widget = nullptr;
 
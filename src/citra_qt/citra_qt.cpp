@@ -3788,10 +3788,10 @@ void GMainWindow::UpdateVolumeUI() {
 
 void GMainWindow::UpdateAPIIndicator(bool update) {
     static std::array graphics_apis = {QStringLiteral("SOFTWARE"), QStringLiteral("OPENGL"),
-                                       QStringLiteral("VULKAN")};
+                                       QStringLiteral("VULKAN"), QStringLiteral("NULL")};
 
     static std::array graphics_api_colors = {QStringLiteral("#3ae400"), QStringLiteral("#00ccdd"),
-                                             QStringLiteral("#91242a")};
+                                             QStringLiteral("#91242a"), QStringLiteral("#808080")};
 
     u32 api_index = static_cast<u32>(Settings::values.graphics_api.GetValue());
     if (update) {
@@ -3818,6 +3818,10 @@ void GMainWindow::UpdateAPIIndicator(bool update) {
             }
         }
 #endif
+        // The null renderer is only meant for headless benchmarking.
+        if (api_index == static_cast<u32>(Settings::GraphicsAPI::Null)) {
+            api_index = (api_index + 1) % graphics_apis.size();
+        }
         Settings::values.graphics_api = static_cast<Settings::GraphicsAPI>(api_index);
     }
 
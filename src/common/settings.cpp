@@ -36,6 +36,8 @@ std::string_view GetGraphicsAPIName(GraphicsAPI api) {
         return "OpenGL";
     case GraphicsAPI::Vulkan:
         return "Vulkan";
+    case GraphicsAPI::Null:
+        return "Null";
     default:
         return "Invalid";
     }
@@ -88,11 +90,13 @@ void LogSettings() {
     LOG_INFO(Config, "Azahar Configuration:");
     log_setting("Core_UseCpuJit", values.use_cpu_jit.GetValue());
     log_setting("Core_CPUClockPercentage", values.cpu_clock_percentage.GetValue());
+    log_setting("Core_EnableIdleLoopSkipping", values.enable_idle_loop_skipping.GetValue());
     log_setting("Controller_UseArticController", values.use_artic_base_controller.GetValue());
     log_setting("Renderer_UseGLES", values.use_gles.GetValue());
     log_setting("Renderer_GraphicsAPI", GetGraphicsAPIName(values.graphics_api.GetValue()));
     log_setting("Renderer_AsyncShaders", values.async_shader_compilation.GetValue());
     log_setting("Renderer_AsyncPresentation", values.async_presentation.GetValue());
+    log_setting("Renderer_ParallelCommandRecording", values.parallel_command_recording.GetValue());
     log_setting("Renderer_SpirvShaderGen", values.spirv_shader_gen.GetValue());
     log_setting("Renderer_DisableSpirvOptimizer", values.disable_spirv_optimizer.GetValue());
     log_setting("Renderer_Debug", values.renderer_debug.GetValue());
@@ -143,6 +147,8 @@ void LogSettings() {
     log_setting("Audio_InputDevice", values.input_device.GetValue());
     log_setting("Audio_EnableAudioStretching", values.enable_audio_stretching.GetValue());
     log_setting("Audio_EnableRealtime", values.enable_realtime_audio.GetValue());
+    log_setting("Audio_EnablePolyphaseInterpolation",
+                values.enable_polyphase_interpolation.GetValue());
     using namespace Service::CAM;
     log_setting("Camera_OuterRightName", values.camera_name[OuterRightCamera]);
     log_setting("Camera_OuterRightConfig", values.camera_config[OuterRightCamera]);
@@ -200,6 +206,7 @@ void RestoreGlobalState(bool is_powered_on) {
     values.audio_emulation.SetGlobal(true);
     values.enable_audio_stretching.SetGlobal(true);
     values.enable_realtime_audio.SetGlobal(true);
+    values.enable_polyphase_interpolation.SetGlobal(true);
     values.volume.SetGlobal(true);
 
     // Core
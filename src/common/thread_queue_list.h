@@ -6,8 +6,10 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <deque>
 #include <tuple>
+#include <utility>
 #include <boost/serialization/deque.hpp>
 #include <boost/serialization/split_member.hpp>
 #include "common/common_types.h"
@@ -24,6 +26,7 @@ struct ThreadQueueList {
 
     // Number of priority levels. (Valid levels are [0..NUM_QUEUES).)
     static constexpr Priority NUM_QUEUES = N;
+    static_assert(N <= 64, "Non-empty priority levels are tracked in a 64-bit mask");
 
     ThreadQueueList() {
         first = nullptr;
@@ -42,43 +45,53 @@ struct ThreadQueueList {
     }
 
     [[nodiscard]] T get_first() const {
-        const Queue* cur = first;
-        while (cur != nullptr) {
-            if (!cur->data.empty()) {
-                return cur->data.front();
-            }
-            cur = cur->next_nonempty;
+        if (nonempty_mask == 0) {
+            return T();
         }
-
-        return T();
+        return queues[std::countr_zero(nonempty_mask)].data.front();
     }
 
     std::pair<Priority, T> pop_first() {
-        Queue* cur = first;
-        while (cur != nullptr) {
-            if (!cur->data.empty()) {
-                auto tmp = std::move(cur->data.front());
-                cur->data.pop_front();
-                Priority prio = static_cast<Priority>(ToIndex(cur));
-                return {prio, tmp};
-            }
-            cur = cur->next_nonempty;
-        }
-
-        return {Priority(), T()};
+        return pop_first_better(NUM_QUEUES);
     }
 
     std::pair<Priority, T> pop_first_better(Priority priority) {
-        Queue* cur = first;
-        Queue* stop = &queues[priority];
-        while (cur < stop) {
-            if (!cur->data.empty()) {
-                auto tmp = std::move(cur->data.front());
-                cur->data.pop_front();
-                Priority prio = static_cast<Priority>(ToIndex(cur));
+        const u64 candidates = nonempty_mask & MaskBelow(priority);
+        if (candidates == 0) {
+            return {Priority(), T()};
+        }
+
+        const Priority prio = static_cast<Priority>(std::countr_zero(candidates));
+        Queue* cur = &queues[prio];
+        auto tmp = std::move(cur->data.front());
+        cur->data.pop_front();
+        update_mask(prio);
+        return {prio, tmp};
+    }
+
+    /**
+     * Pops the first entry that satisfies pred, searching priority levels from the highest.
+     * Entries that are skipped over keep their position in the queue.
+     */
+    template <typename Predicate>
+    std::pair<Priority, T> pop_first_if(Predicate&& pred) {
+        return pop_first_better_if(NUM_QUEUES, std::forward<Predicate>(pred));
+    }
+
+    /// Like pop_first_if, but only considers levels with a better priority than the given one.
+    template <typename Predicate>
+    std::pair<Priority, T> pop_first_better_if(Priority priority, Predicate&& pred) {
+        for (u64 candidates = nonempty_mask & MaskBelow(priority); candidates != 0;
+             candidates &= candidates - 1) {
+            const Priority prio = static_cast<Priority>(std::countr_zero(candidates));
+            Queue* cur = &queues[prio];
+            const auto iter = std::find_if(cur->data.begin(), cur->data.end(), pred);
+            if (iter != cur->data.end()) {
+                auto tmp = std::move(*iter);
+                cur->data.erase(iter);
+                update_mask(prio);
                 return {prio, tmp};
             }
-            cur = cur->next_nonempty;
         }
 
         return {Priority(), T()};
@@ -87,11 +100,13 @@ struct ThreadQueueList {
     void push_front(Priority priority, const T& thread_id) {
         Queue* cur = &queues[priority];
         cur->data.push_front(thread_id);
+        nonempty_mask |= u64{1} << priority;
     }
 
     void push_back(Priority priority, const T& thread_id) {
         Queue* cur = &queues[priority];
         cur->data.push_back(thread_id);
+        nonempty_mask |= u64{1} << priority;
     }
 
     void move(const T& thread_id, Priority old_priority, Priority new_priority) {
@@ -104,6 +119,7 @@ struct ThreadQueueList {
         Queue* const cur = &queues[priority];
         const auto iter = std::remove(cur->data.begin(), cur->data.end(), thread_id);
         cur->data.erase(iter, cur->data.end());
+        update_mask(priority);
     }
 
     void rotate(Priority priority) {
@@ -118,6 +134,7 @@ struct ThreadQueueList {
     void clear() {
         queues.fill(Queue());
         first = nullptr;
+        nonempty_mask = 0;
     }
 
     [[nodiscard]] bool empty(Priority priority) const {
@@ -139,6 +156,19 @@ private:
         std::deque<T> data;
     };
 
+    /// Returns a mask of all priority levels better than the given one.
+    static constexpr u64 MaskBelow(Priority priority) {
+        return priority >= 64 ? ~u64{0} : (u64{1} << priority) - 1;
+    }
+
+    void update_mask(Priority priority) {
+        if (queues[priority].data.empty()) {
+            nonempty_mask &= ~(u64{1} << priority);
+        } else {
+            nonempty_mask |= u64{1} << priority;
+        }
+    }
+
     /// Special tag used to mark priority levels that have never been used.
     static Queue* UnlinkedTag() {
         return reinterpret_cast<Queue*>(1);
@@ -163,6 +193,9 @@ private:
     Queue* first;
     // The priority level queues of thread ids.
     std::array<Queue, NUM_QUEUES> queues;
+    // Bit i is set when queues[i] holds at least one entry, so the best non-empty level can be
+    // found with a single bit scan. Not serialized, it is rebuilt from the queues on load.
+    u64 nonempty_mask = 0;
 
     s64 ToIndex(const Queue* q) const {
         if (q == nullptr) {
@@ -206,6 +239,10 @@ private:
             queues[i].next_nonempty = ToPointer(idx);
             ar >> queues[i].data;
         }
+        nonempty_mask = 0;
+        for (Priority i = 0; i < NUM_QUEUES; i++) {
+            update_mask(i);
+        }
     }
 
     BOOST_SERIALIZATION_SPLIT_MEMBER()
@@ -8,16 +8,20 @@
 #include <dynarmic/interface/optimization_flags.h>
 #include "common/assert.h"
 #include "common/microprofile.h"
+#include "common/settings.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/arm_dynarmic_cp15.h"
 #include "core/arm/dynarmic/arm_exclusive_monitor.h"
+#include "core/arm/dynarmic/arm_idle_loop.h"
 #include "core/arm/dynarmic/arm_tick_counts.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #ifdef ENABLE_GDBSTUB
 #include "core/gdbstub/gdbstub.h"
 #endif
+#include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/thread.h"
 #include "core/memory.h"
 
 #ifndef SIGILL
@@ -30,6 +34,9 @@ constexpr u32 SIGTRAP = 5;
 
 namespace Core {
 
+constexpr u32 CPSR_THUMB_BIT = 1 << 5;
+constexpr std::uint32_t SVC_SLEEP_THREAD = 0x0A;
+
 class DynarmicUserCallbacks final : public Dynarmic::A32::UserCallbacks {
 public:
     explicit DynarmicUserCallbacks(ARM_Dynarmic& parent)
@@ -87,6 +94,11 @@ public:
 
     void CallSVC(std::uint32_t swi) override {
         svc_context.CallSVC(swi);
+        if (swi == SVC_SLEEP_THREAD) {
+            parent.OnSleepThreadReturned();
+        } else {
+            parent.sleep_idle_loop.reset();
+        }
     }
 
     void ExceptionRaised(VAddr pc, Dynarmic::A32::Exception exception) override {
@@ -187,7 +199,13 @@ void ARM_Dynarmic::Run() {
         return;
     }
 
+    if (slice_idle_loop && TrySkipIdleLoop()) {
+        return;
+    }
+
     jit->Run();
+
+    slice_idle_loop = MakeIdleLoop(false);
 }
 
 void ARM_Dynarmic::Step() {
@@ -342,6 +360,68 @@ void ARM_Dynarmic::SetPageTable(const std::shared_ptr<Memory::PageTable>& page_t
     jits.emplace(current_page_table, std::move(new_jit));
 }
 
+bool ARM_Dynarmic::MatchesIdleLoop(const IdleLoop& loop) const {
+    return jit->Regs()[15] == loop.pc && jit->Cpsr() == loop.cpsr && jit->Regs() == loop.regs;
+}
+
+std::optional<ARM_Dynarmic::IdleLoop> ARM_Dynarmic::MakeIdleLoop(bool allow_sleep_svc) {
+    if (!Settings::values.enable_idle_loop_skipping.GetValue() ||
+        (jit->Cpsr() & CPSR_THUMB_BIT) != 0) {
+        return std::nullopt;
+    }
+    const u32 pc = GetPC();
+    const std::size_t length = FindIdleLoopLength(memory, pc, allow_sleep_svc);
+    if (length == 0) {
+        return std::nullopt;
+    }
+    return IdleLoop{pc, jit->Cpsr(), jit->Regs(), length};
+}
+
+bool ARM_Dynarmic::TrySkipIdleLoop() {
+    const IdleLoop loop = *slice_idle_loop;
+    slice_idle_loop.reset();
+
+    // Another thread (or a different context switched in) may be able to use the time instead.
+    if (!MatchesIdleLoop(loop) || system.Kernel().GetCurrentThreadManager().HaveReadyThreads()) {
+        return false;
+    }
+
+    // The loop does not store to memory, so if one iteration ends in the exact state it started
+    // from, every following iteration will too until something outside this core intervenes.
+    for (std::size_t i = 0; i < loop.length && !break_flag; ++i) {
+        jit->Step();
+    }
+    if (!MatchesIdleLoop(loop)) {
+        return false;
+    }
+
+    LOG_TRACE(Core_ARM11, "Core {} skipping idle loop at {:08X}", GetID(), loop.pc);
+    GetTimer().Idle();
+    return true;
+}
+
+void ARM_Dynarmic::OnSleepThreadReturned() {
+    // svcSleepThread(0) returns straight away when no other thread is ready. Seeing it return
+    // twice from a store-free loop with identical state means the thread is polling for
+    // something only an event can change, so jump ahead to the end of the slice.
+    const Kernel::Thread* thread = system.Kernel().GetCurrentThreadManager().GetCurrentThread();
+    if (thread == nullptr || thread->status != Kernel::ThreadStatus::Running) {
+        sleep_idle_loop.reset();
+        return;
+    }
+
+    if (sleep_idle_loop && MatchesIdleLoop(*sleep_idle_loop)) {
+        LOG_TRACE(Core_ARM11, "Core {} skipping svcSleepThread loop at {:08X}", GetID(),
+                  sleep_idle_loop->pc);
+        sleep_idle_loop.reset();
+        GetTimer().Idle();
+        PrepareReschedule();
+        return;
+    }
+
+    sleep_idle_loop = MakeIdleLoop(true);
+}
+
 void ARM_Dynarmic::ServeBreak([[maybe_unused]] int signal) {
 #ifdef ENABLE_GDBSTUB
     GDBStub::Break(signal);
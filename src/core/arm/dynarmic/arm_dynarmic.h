@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <memory>
+#include <optional>
 #include <dynarmic/interface/A32/a32.h>
 #include "common/common_types.h"
 #include "core/arm/arm_interface.h"
@@ -66,6 +68,28 @@ protected:
 private:
     void ServeBreak(int signal);
 
+    /// Guest state observed inside a loop that may be waiting on an external event.
+    struct IdleLoop {
+        u32 pc{};
+        u32 cpsr{};
+        std::array<u32, 16> regs{};
+        std::size_t length{};
+    };
+
+    bool MatchesIdleLoop(const IdleLoop& loop) const;
+    std::optional<IdleLoop> MakeIdleLoop(bool allow_sleep_svc);
+
+    /**
+     * Runs a single iteration of the loop recorded at the end of the previous slice. If the
+     * guest state is unchanged afterwards the loop cannot make progress until an event fires,
+     * so the remainder of the slice is idled.
+     * @returns true if the slice was skipped.
+     */
+    bool TrySkipIdleLoop();
+
+    /// Detects threads polling svcSleepThread(0) while nothing else is ready to run.
+    void OnSleepThreadReturned();
+
     friend class DynarmicUserCallbacks;
     Core::System& system;
     Memory::MemorySystem& memory;
@@ -79,6 +103,9 @@ private:
     Dynarmic::A32::Jit* jit = nullptr;
     std::shared_ptr<Memory::PageTable> current_page_table = nullptr;
     std::map<std::shared_ptr<Memory::PageTable>, std::unique_ptr<Dynarmic::A32::Jit>> jits;
+
+    std::optional<IdleLoop> slice_idle_loop;
+    std::optional<IdleLoop> sleep_idle_loop;
 };
 
 } // namespace Core
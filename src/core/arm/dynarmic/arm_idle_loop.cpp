@@ -0,0 +1,169 @@
+// Copyright 2026 Citra Emulator Project / Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <optional>
+#include "core/arm/dynarmic/arm_idle_loop.h"
+#include "core/memory.h"
+
+namespace Core {
+
+namespace {
+
+constexpr u32 ConditionAlways = 0xE;
+constexpr u32 ConditionUnconditional = 0xF;
+constexpr u32 SleepThreadSVC = 0x0A;
+
+constexpr u32 RegisterPC = 15;
+
+constexpr bool Bit(u32 inst, u32 bit) {
+    return ((inst >> bit) & 1) != 0;
+}
+
+constexpr u32 Register(u32 inst, u32 lsb) {
+    return (inst >> lsb) & 0xF;
+}
+
+/// Returns Pure, unless the instruction writes the register at lsb and that register is PC.
+/// Writing PC branches to a target the loop body was not checked against.
+constexpr IdleLoopInstructionKind PureUnlessPC(u32 inst, u32 lsb) {
+    return Register(inst, lsb) == RegisterPC ? IdleLoopInstructionKind::SideEffect
+                                             : IdleLoopInstructionKind::Pure;
+}
+
+VAddr BranchTarget(VAddr addr, u32 inst) {
+    const s32 offset = static_cast<s32>(inst << 8) >> 6;
+    return addr + 8 + offset;
+}
+
+} // Anonymous namespace
+
+IdleLoopInstructionKind ClassifyIdleLoopInstruction(u32 inst, bool allow_sleep_svc) {
+    using Kind = IdleLoopInstructionKind;
+    const u32 cond = inst >> 28;
+    if (cond == ConditionUnconditional) {
+        return Kind::SideEffect;
+    }
+
+    switch ((inst >> 25) & 0x7) {
+    case 0b000:
+        // Multiplies, swaps and exclusive accesses
+        if ((inst & 0xF0) == 0x90) {
+            if ((inst & 0x0F800000) == 0x01000000) {
+                // SWP/SWPB
+                return Kind::SideEffect;
+            }
+            if ((inst & 0x0F800000) == 0x01800000) {
+                // LDREX* are fine, STREX* write memory
+                return Bit(inst, 20) ? PureUnlessPC(inst, 12) : Kind::SideEffect;
+            }
+            // Long multiplies also write RdLo
+            if (Bit(inst, 23) && Register(inst, 12) == RegisterPC) {
+                return Kind::SideEffect;
+            }
+            return PureUnlessPC(inst, 16);
+        }
+        // Halfword, signed byte and doubleword transfers
+        if ((inst & 0x90) == 0x90) {
+            const u32 op2 = (inst >> 5) & 0x3;
+            if (Bit(inst, 20)) {
+                return PureUnlessPC(inst, 12);
+            }
+            // LDRD shares the L=0 encoding space with STRH and STRD. It writes Rt and Rt+1.
+            if (op2 == 0b10) {
+                return Register(inst, 12) >= RegisterPC - 1 ? Kind::SideEffect : Kind::Pure;
+            }
+            return Kind::SideEffect;
+        }
+        [[fallthrough]];
+    case 0b001:
+        // Hints (NOP, YIELD, WFE, WFI, SEV) are harmless
+        if ((inst & 0x0FFFFF00) == 0x0320F000) {
+            return Kind::Pure;
+        }
+        // MSR, BX, BLX and friends
+        if ((inst & 0x01900000) == 0x01000000) {
+            return Kind::SideEffect;
+        }
+        // TST, TEQ, CMP and CMN have no destination
+        if ((inst & 0x01800000) == 0x01000000) {
+            return Kind::Pure;
+        }
+        return PureUnlessPC(inst, 12);
+    case 0b010:
+    case 0b011:
+        // Media instructions only operate on registers. Depending on the instruction the
+        // destination is at bit 12 or bit 16, so PC in either field is rejected.
+        if ((inst & 0x02000010) == 0x02000010) {
+            return Register(inst, 16) == RegisterPC ? Kind::SideEffect : PureUnlessPC(inst, 12);
+        }
+        // Single loads are fine, stores write memory
+        return Bit(inst, 20) ? PureUnlessPC(inst, 12) : Kind::SideEffect;
+    case 0b100:
+        // LDM is fine unless it loads PC or restores user mode registers, STM writes memory
+        if (!Bit(inst, 20) || Bit(inst, 22) || Bit(inst, RegisterPC)) {
+            return Kind::SideEffect;
+        }
+        return Kind::Pure;
+    case 0b101:
+        // BL calls into code we have not inspected
+        return Bit(inst, 24) ? Kind::SideEffect : Kind::Branch;
+    case 0b111:
+        if (allow_sleep_svc && (inst & 0x0F000000) == 0x0F000000 &&
+            (inst & 0x00FFFFFF) == SleepThreadSVC) {
+            return Kind::Pure;
+        }
+        return Kind::SideEffect;
+    default:
+        // Coprocessor and VFP accesses
+        return Kind::SideEffect;
+    }
+}
+
+std::size_t FindIdleLoopLength(Memory::MemorySystem& memory, VAddr pc, bool allow_sleep_svc) {
+    const auto is_acceptable = [&](VAddr addr, u32 inst) {
+        switch (ClassifyIdleLoopInstruction(inst, allow_sleep_svc)) {
+        case IdleLoopInstructionKind::Pure:
+            return true;
+        case IdleLoopInstructionKind::Branch:
+            // Conditional exits are fine, whether the loop is left is caught by the caller
+            // comparing guest state after an iteration.
+            return (inst >> 28) != ConditionAlways && BranchTarget(addr, inst) > addr;
+        default:
+            return false;
+        }
+    };
+
+    // Scan forward from pc for the branch that closes the loop.
+    for (std::size_t i = 0; i < MaxIdleLoopLength; ++i) {
+        const VAddr addr = pc + static_cast<VAddr>(i * 4);
+        const std::optional<u32> inst = memory.Read32OrNullopt(addr);
+        if (!inst) {
+            return 0;
+        }
+        if (ClassifyIdleLoopInstruction(*inst, allow_sleep_svc) ==
+            IdleLoopInstructionKind::Branch) {
+            const VAddr target = BranchTarget(addr, *inst);
+            if (target <= pc) {
+                const std::size_t length = (addr - target) / 4 + 1;
+                if (length > MaxIdleLoopLength) {
+                    return 0;
+                }
+                // Verify the part of the body that precedes pc as well.
+                for (VAddr body = target; body < pc; body += 4) {
+                    const std::optional<u32> body_inst = memory.Read32OrNullopt(body);
+                    if (!body_inst || !is_acceptable(body, *body_inst)) {
+                        return 0;
+                    }
+                }
+                return length;
+            }
+        }
+        if (!is_acceptable(addr, *inst)) {
+            return 0;
+        }
+    }
+    return 0;
+}
+
+} // namespace Core
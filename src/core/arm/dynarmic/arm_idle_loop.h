@@ -0,0 +1,40 @@
+// Copyright 2026 Citra Emulator Project / Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include "common/common_types.h"
+
+namespace Memory {
+class MemorySystem;
+}
+
+namespace Core {
+
+/// Longest loop body, in instructions, that is considered for idle loop skipping.
+constexpr std::size_t MaxIdleLoopLength = 16;
+
+enum class IdleLoopInstructionKind : u8 {
+    /// Has no side effects outside of the register file.
+    Pure,
+    /// B, with a PC-relative target.
+    Branch,
+    /// Writes memory or PC, calls a function or otherwise cannot be repeated freely.
+    SideEffect,
+};
+
+/// Classifies an ARM mode instruction for idle loop detection.
+IdleLoopInstructionKind ClassifyIdleLoopInstruction(u32 inst, bool allow_sleep_svc);
+
+/**
+ * Checks whether the ARM mode code around pc forms a short loop that can be skipped once it is
+ * known to make no progress. Such a loop only loads from memory, compares and branches back;
+ * it must not store to memory, call functions or touch coprocessors. When allow_sleep_svc is
+ * set, svcSleepThread is also accepted inside the loop body.
+ * @returns The number of instructions in the loop, or 0 if pc is not inside such a loop.
+ */
+std::size_t FindIdleLoopLength(Memory::MemorySystem& memory, VAddr pc, bool allow_sleep_svc);
+
+} // namespace Core
@@ -12,6 +12,74 @@
 
 namespace Core {
 
+namespace {
+
+using EventQueue = std::vector<Timing::Event>;
+
+/// Moves the event at index towards the root until the min-heap property holds again.
+void SiftUp(EventQueue& queue, std::size_t index) {
+    while (index > 0) {
+        const std::size_t parent = (index - 1) / 2;
+        if (!(queue[parent] > queue[index])) {
+            break;
+        }
+        std::swap(queue[parent], queue[index]);
+        index = parent;
+    }
+}
+
+/// Moves the event at index towards the leaves until the min-heap property holds again.
+void SiftDown(EventQueue& queue, std::size_t index) {
+    const std::size_t size = queue.size();
+    while (true) {
+        const std::size_t left = index * 2 + 1;
+        if (left >= size) {
+            break;
+        }
+        const std::size_t right = left + 1;
+        std::size_t smallest = left;
+        if (right < size && queue[left] > queue[right]) {
+            smallest = right;
+        }
+        if (!(queue[index] > queue[smallest])) {
+            break;
+        }
+        std::swap(queue[index], queue[smallest]);
+        index = smallest;
+    }
+}
+
+/**
+ * Removes every event matching pred from the heap in a single scan. Matches are almost always
+ * unique (one pending wakeup per thread, one tick event per service), in which case the erased
+ * slot is replaced with the last event and the heap is repaired locally in O(log n). Several
+ * matches are compacted away together and the heap is rebuilt once.
+ */
+template <typename Predicate>
+void RemoveEventsIf(EventQueue& queue, Predicate&& pred) {
+    const auto first = std::find_if(queue.begin(), queue.end(), pred);
+    if (first == queue.end()) {
+        return;
+    }
+    if (std::find_if(first + 1, queue.end(), pred) != queue.end()) {
+        queue.erase(std::remove_if(first, queue.end(), pred), queue.end());
+        std::make_heap(queue.begin(), queue.end(), std::greater<>());
+        return;
+    }
+
+    const std::size_t index = static_cast<std::size_t>(first - queue.begin());
+    if (index + 1 != queue.size()) {
+        queue[index] = std::move(queue.back());
+    }
+    queue.pop_back();
+    if (index < queue.size()) {
+        SiftUp(queue, index);
+        SiftDown(queue, index);
+    }
+}
+
+} // Anonymous namespace
+
 // Sort by time, unless the times are the same, in which case sort by the order added to the queue
 bool Timing::Event::operator>(const Timing::Event& right) const {
     return std::tie(time, fifo_order) > std::tie(right.time, right.fifo_order);
@@ -106,16 +174,10 @@ void Timing::UnscheduleEvent(const TimingEventType* event_type, std::uintptr_t u
     if (event_queue_locked) {
         return;
     }
-    for (auto timer : timers) {
-        auto itr = std::remove_if(
-            timer->event_queue.begin(), timer->event_queue.end(),
-            [&](const Event& e) { return e.type == event_type && e.user_data == user_data; });
-
-        // Removing random items breaks the invariant so we have to re-establish it.
-        if (itr != timer->event_queue.end()) {
-            timer->event_queue.erase(itr, timer->event_queue.end());
-            std::make_heap(timer->event_queue.begin(), timer->event_queue.end(), std::greater<>());
-        }
+    for (auto& timer : timers) {
+        RemoveEventsIf(timer->event_queue, [&](const Event& e) {
+            return e.type == event_type && e.user_data == user_data;
+        });
     }
     // TODO:remove events from ts_queue
 }
@@ -124,15 +186,8 @@ void Timing::RemoveEvent(const TimingEventType* event_type) {
     if (event_queue_locked) {
         return;
     }
-    for (auto timer : timers) {
-        auto itr = std::remove_if(timer->event_queue.begin(), timer->event_queue.end(),
-                                  [&](const Event& e) { return e.type == event_type; });
-
-        // Removing random items breaks the invariant so we have to re-establish it.
-        if (itr != timer->event_queue.end()) {
-            timer->event_queue.erase(itr, timer->event_queue.end());
-            std::make_heap(timer->event_queue.begin(), timer->event_queue.end(), std::greater<>());
-        }
+    for (auto& timer : timers) {
+        RemoveEventsIf(timer->event_queue, [&](const Event& e) { return e.type == event_type; });
     }
     // TODO:remove events from ts_queue
 }
@@ -161,7 +216,11 @@ std::shared_ptr<Timing::Timer> Timing::GetTimer(std::size_t cpu_id) {
     return timers[cpu_id];
 }
 
-Timing::Timer::Timer(s64 base_ticks) : executed_ticks(base_ticks) {}
+Timing::Timer::Timer(s64 base_ticks) : executed_ticks(base_ticks) {
+    // A running title keeps a few dozen events pending at any time (thread wakeups, service
+    // ticks, DSP slices). Reserve up front so scheduling never reallocates in steady state.
+    event_queue.reserve(64);
+}
 
 Timing::Timer::~Timer() {
     MoveEvents();
@@ -0,0 +1,140 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "common/assert.h"
+#include "common/thread.h"
+#include "core/hle/kernel/async_executor.h"
+
+namespace Kernel {
+
+AsyncExecutor::AsyncExecutor(std::size_t num_workers) : state{std::make_shared<State>()} {
+    ASSERT(num_workers > 0);
+    workers.reserve(num_workers);
+    for (std::size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back([this](std::stop_token stop_token) { WorkerLoop(stop_token); });
+    }
+}
+
+AsyncExecutor::~AsyncExecutor() {
+    std::deque<std::shared_ptr<AsyncQueue>> dropped;
+    {
+        std::scoped_lock lock{state->mutex};
+        state->stopped = true;
+        for (auto& queue : state->ready) {
+            queue->scheduled = false;
+        }
+        // Released outside of the lock, as dropping the last reference to a queue destroys its
+        // tasks and whatever they captured.
+        dropped.swap(state->ready);
+    }
+    // Wait for the tasks that are already running, then wake up anyone waiting on a queue.
+    workers.clear();
+    state->progress.notify_all();
+}
+
+std::shared_ptr<AsyncQueue> AsyncExecutor::CreateQueue(std::size_t max_running) {
+    ASSERT(max_running > 0);
+    return std::shared_ptr<AsyncQueue>(new AsyncQueue(state, max_running, false));
+}
+
+std::shared_ptr<AsyncQueue> AsyncExecutor::CreateDedicatedQueue() {
+    return std::shared_ptr<AsyncQueue>(new AsyncQueue(state, 0, true));
+}
+
+void AsyncExecutor::WorkerLoop(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("HLE_AsyncWorker");
+    while (!stop_token.stop_requested()) {
+        std::shared_ptr<AsyncQueue> queue;
+        AsyncQueue::Task task;
+        {
+            std::unique_lock lock{state->mutex};
+            Common::CondvarWait(state->work_available, lock, stop_token,
+                                [this] { return !state->ready.empty(); });
+            if (stop_token.stop_requested()) {
+                break;
+            }
+            queue = std::move(state->ready.front());
+            state->ready.pop_front();
+            queue->scheduled = false;
+
+            task = std::move(queue->pending.front());
+            queue->pending.pop_front();
+            ++queue->running;
+
+            // Put the queue back at the end of the ready list if it can start more tasks.
+            queue->ScheduleLocked();
+        }
+        state->progress.notify_all();
+
+        task();
+
+        {
+            std::scoped_lock lock{state->mutex};
+            --queue->running;
+            queue->ScheduleLocked();
+        }
+        state->progress.notify_all();
+    }
+}
+
+AsyncQueue::AsyncQueue(std::shared_ptr<AsyncExecutor::State> state_, std::size_t max_running_,
+                       bool dedicated_)
+    : state{std::move(state_)}, max_running{max_running_}, dedicated{dedicated_} {}
+
+void AsyncQueue::Submit(Task task) {
+    if (dedicated) {
+        StartThread(std::move(task));
+        return;
+    }
+    {
+        std::scoped_lock lock{state->mutex};
+        if (!state->stopped) {
+            pending.push_back(std::move(task));
+            ScheduleLocked();
+            return;
+        }
+    }
+    task();
+}
+
+void AsyncQueue::StartThread(Task task) {
+    std::vector<std::future<void>> finished;
+    std::scoped_lock lock{state->mutex};
+    std::erase_if(threads, [&finished](std::future<void>& thread) {
+        if (thread.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return false;
+        }
+        finished.push_back(std::move(thread));
+        return true;
+    });
+
+    ++running;
+    threads.push_back(std::async(std::launch::async, [this, task = std::move(task)]() mutable {
+        task();
+        {
+            std::scoped_lock lock{state->mutex};
+            --running;
+        }
+        state->progress.notify_all();
+    }));
+}
+
+void AsyncQueue::WaitIdle() {
+    std::unique_lock lock{state->mutex};
+    state->progress.wait(lock, [this] {
+        // Tasks left pending once the executor shuts down will never run.
+        return running == 0 && (pending.empty() || state->stopped);
+    });
+}
+
+void AsyncQueue::ScheduleLocked() {
+    if (scheduled || state->stopped || pending.empty() || running >= max_running) {
+        return;
+    }
+    scheduled = true;
+    state->ready.push_back(shared_from_this());
+    state->work_available.notify_one();
+}
+
+} // namespace Kernel
@@ -0,0 +1,112 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "common/polyfill_thread.h"
+#include "common/unique_function.h"
+
+namespace Kernel {
+
+class AsyncQueue;
+
+/**
+ * Bounded pool of host threads running the blocking sections of HLE service requests (file I/O,
+ * network access, ...), so that they don't need a fresh host thread each. Work is submitted
+ * through AsyncQueues, usually one per service. Idle workers serve the queues that have runnable
+ * work in round-robin order, so a busy service cannot starve the others. Tasks which can block
+ * for an unbounded time must not occupy the workers, their queues run each task on a host thread
+ * of its own instead.
+ */
+class AsyncExecutor {
+public:
+    explicit AsyncExecutor(std::size_t num_workers);
+    ~AsyncExecutor();
+
+    AsyncExecutor(const AsyncExecutor&) = delete;
+    AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+    /**
+     * Creates a new queue on this executor.
+     * @param max_running Maximum number of tasks from the queue running at the same time. A value
+     * of 1 makes the queue run its tasks in submission order.
+     */
+    std::shared_ptr<AsyncQueue> CreateQueue(std::size_t max_running);
+
+    /**
+     * Creates a queue which starts a host thread for each of its tasks, for tasks that may wait on
+     * the host without a timeout, such as a socket waiting for its peer.
+     */
+    std::shared_ptr<AsyncQueue> CreateDedicatedQueue();
+
+    std::size_t NumWorkers() const {
+        return workers.size();
+    }
+
+private:
+    friend class AsyncQueue;
+
+    /// State shared with the queues, which may outlive the executor.
+    struct State {
+        std::mutex mutex;
+        std::condition_variable_any work_available;
+        /// Notified whenever a queued task starts or finishes running.
+        std::condition_variable progress;
+        /// Queues with pending tasks that are allowed to start another one.
+        std::deque<std::shared_ptr<AsyncQueue>> ready;
+        bool stopped = false;
+    };
+
+    void WorkerLoop(std::stop_token stop_token);
+
+    std::shared_ptr<State> state;
+    std::vector<std::jthread> workers;
+};
+
+/// FIFO of tasks run by an AsyncExecutor. Obtained from AsyncExecutor::CreateQueue.
+class AsyncQueue : public std::enable_shared_from_this<AsyncQueue> {
+public:
+    using Task = Common::UniqueFunction<void>;
+
+    /**
+     * Queues a task to be run by the executor. If the executor has already been shut down, the
+     * task is run on the calling thread instead.
+     */
+    void Submit(Task task);
+
+    /// Blocks until every task submitted to this queue has finished running.
+    void WaitIdle();
+
+private:
+    friend class AsyncExecutor;
+
+    AsyncQueue(std::shared_ptr<AsyncExecutor::State> state, std::size_t max_running,
+               bool dedicated);
+
+    /// Adds the queue to the executor's ready list if it can start a task. Requires the lock.
+    void ScheduleLocked();
+
+    /// Runs the task on a new host thread. Used by dedicated queues.
+    void StartThread(Task task);
+
+    std::shared_ptr<AsyncExecutor::State> state;
+    const std::size_t max_running;
+    const bool dedicated;
+
+    // Guarded by state->mutex
+    std::deque<Task> pending;
+    std::size_t running = 0;
+    bool scheduled = false;
+    /// Host threads started by a dedicated queue. Finished ones are joined on the next Submit.
+    std::vector<std::future<void>> threads;
+};
+
+} // namespace Kernel
@@ -88,6 +88,24 @@ public:
         return DynamicObjectCast<T>(GetGeneric(handle));
     }
 
+    /**
+     * Looks up a handle without taking a reference to the object. The returned pointer stays
+     * valid only as long as the handle is open, so it must not outlive the SVC that looked it
+     * up or be held across anything that may close handles.
+     * @return Pointer to the looked-up object, or `nullptr` if the handle is not valid.
+     */
+    Object* GetGenericBorrowed(Handle handle) const;
+
+    /**
+     * Looks up a handle without taking a reference to the object, while verifying its type.
+     * @return Pointer to the looked-up object, or `nullptr` if the handle is not valid or its
+     *         type differs from the requested one.
+     */
+    template <class T>
+    T* GetBorrowed(Handle handle) const {
+        return DynamicObjectCast<T>(GetGenericBorrowed(handle));
+    }
+
     /// Closes all handles held in this table.
     void Clear();
 
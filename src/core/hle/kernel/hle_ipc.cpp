@@ -91,6 +91,20 @@ void SessionRequestHandler::ClientDisconnected(std::shared_ptr<ServerSession> se
         connected_sessions.end());
 }
 
+AsyncQueue& SessionRequestHandler::GetAsyncQueue(KernelSystem& kernel) {
+    if (!async_queue) {
+        AsyncExecutor& executor = kernel.GetAsyncExecutor();
+        if (dedicated_async_threads) {
+            async_queue = executor.CreateDedicatedQueue();
+        } else {
+            // Leave workers free for other services when this one issues slow requests.
+            async_queue =
+                executor.CreateQueue(std::max<std::size_t>(1, executor.NumWorkers() / 2));
+        }
+    }
+    return *async_queue;
+}
+
 template <class Archive>
 void SessionRequestHandler::serialize(Archive& ar, const unsigned int) {
     ar & connected_sessions;
@@ -135,6 +149,18 @@ HLERequestContext::HLERequestContext(KernelSystem& kernel, std::shared_ptr<Serve
 
 HLERequestContext::~HLERequestContext() = default;
 
+void HLERequestContext::Reset(std::shared_ptr<ServerSession> session_,
+                              std::shared_ptr<Thread> thread_) {
+    session = std::move(session_);
+    thread = std::move(thread_);
+    cmd_buf[0] = 0;
+    request_handles.clear();
+    for (auto& buffer : static_buffers) {
+        buffer.clear();
+    }
+    request_mapped_buffers.clear();
+}
+
 std::shared_ptr<Object> HLERequestContext::GetIncomingHandle(u32 id_from_cmdbuf) const {
     ASSERT(id_from_cmdbuf < request_handles.size());
     return request_handles[id_from_cmdbuf];
@@ -208,11 +234,12 @@ Result HLERequestContext::PopulateFromIncomingCommandBuffer(const u32_le* src_cm
             VAddr source_address = src_cmdbuf[i];
             IPC::StaticBufferDescInfo buffer_info{descriptor};
 
-            // Copy the input buffer into our own vector and store it.
-            std::vector<u8> data(buffer_info.size);
+            // Copy the input buffer into our own vector, reusing the storage left over from a
+            // previous request if there is any.
+            std::vector<u8>& data = static_buffers[buffer_info.buffer_id];
+            data.resize(buffer_info.size);
             kernel.memory.ReadBlock(src_process, source_address, data.data(), data.size());
 
-            AddStaticBuffer(buffer_info.buffer_id, std::move(data));
             cmd_buf[i++] = source_address;
             break;
         }
@@ -359,4 +386,25 @@ void MappedBuffer::Write(const void* src_buffer, std::size_t offset, std::size_t
     memory->WriteBlock(*process, address + static_cast<VAddr>(offset), src_buffer, size);
 }
 
+std::span<const u8> MappedBuffer::GetReadSpan(std::size_t offset, std::size_t size) {
+    ASSERT(perms & IPC::R);
+    ASSERT(offset + size <= this->size);
+    return memory->GetBlockSpan(*process, address + static_cast<VAddr>(offset), size);
+}
+
+std::span<u8> MappedBuffer::GetWriteSpan(std::size_t offset, std::size_t size) {
+    ASSERT(perms & IPC::W);
+    ASSERT(offset + size <= this->size);
+    return memory->GetBlockSpan(*process, address + static_cast<VAddr>(offset), size);
+}
+
+void MappedBuffer::InvalidateWritten(std::size_t offset, std::size_t size) {
+    ASSERT(offset + size <= this->size);
+    if (size == 0) {
+        return;
+    }
+    memory->RasterizerFlushVirtualRegion(address + static_cast<VAddr>(offset),
+                                         static_cast<u32>(size), Memory::FlushMode::Invalidate);
+}
+
 } // namespace Kernel
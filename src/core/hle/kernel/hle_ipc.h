@@ -9,6 +9,7 @@
 #include <chrono>
 #include <future>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 #include <boost/container/small_vector.hpp>
@@ -17,8 +18,8 @@
 #include "common/serialization/boost_small_vector.hpp"
 #include "common/settings.h"
 #include "common/swap.h"
-#include "common/thread_worker.h"
 #include "core/hle/ipc.h"
+#include "core/hle/kernel/async_executor.h"
 #include "core/hle/kernel/object.h"
 #include "core/hle/kernel/server_session.h"
 
@@ -69,6 +70,12 @@ public:
      */
     virtual void ClientDisconnected(std::shared_ptr<ServerSession> server_session);
 
+    /**
+     * Returns the queue that the async sections of this handler's requests are run from,
+     * creating it on first use.
+     */
+    AsyncQueue& GetAsyncQueue(KernelSystem& kernel);
+
     /// Empty placeholder structure for services with no per-session data. The session data classes
     /// in each service must inherit from this.
     struct SessionDataBase {
@@ -94,6 +101,16 @@ public:
     };
 
 protected:
+    /**
+     * Makes the async sections of this handler's requests run on host threads of their own,
+     * instead of the shared workers of the async executor. Must be used by services whose
+     * requests can wait on the host without a timeout, otherwise a few of them blocked at once
+     * would hold on to every worker the service may use and starve its other requests.
+     */
+    void UseDedicatedAsyncThreads() {
+        dedicated_async_threads = true;
+    }
+
     /// Creates the storage for the session data of the service.
     virtual std::unique_ptr<SessionDataBase> MakeSessionData() = 0;
 
@@ -113,6 +130,9 @@ protected:
     std::vector<SessionInfo> connected_sessions;
 
 private:
+    std::shared_ptr<AsyncQueue> async_queue;
+    bool dedicated_async_threads = false;
+
     template <class Archive>
     void serialize(Archive& ar, const unsigned int);
     friend class boost::serialization::access;
@@ -128,6 +148,22 @@ public:
     // interface for service
     void Read(void* dest_buffer, std::size_t offset, std::size_t size);
     void Write(const void* src_buffer, std::size_t offset, std::size_t size);
+
+    /**
+     * Returns a view directly onto the guest memory backing [offset, offset + size) of the
+     * buffer, or an empty span when that range can't be accessed in place (e.g. it is cached by
+     * the rasterizer), in which case Read/Write have to be used instead.
+     */
+    std::span<const u8> GetReadSpan(std::size_t offset, std::size_t size);
+    std::span<u8> GetWriteSpan(std::size_t offset, std::size_t size);
+
+    /**
+     * Invalidates the rasterizer cache over [offset, offset + size) of the buffer. Must be called
+     * from the emulation thread once a span from GetWriteSpan has been written from another
+     * thread, as the GPU may have started caching the memory in the meantime.
+     */
+    void InvalidateWritten(std::size_t offset, std::size_t size);
+
     std::size_t GetSize() const {
         return size;
     }
@@ -198,6 +234,12 @@ public:
                       std::shared_ptr<Thread> thread);
     ~HLERequestContext();
 
+    /**
+     * Prepares the context to handle a new request, dropping everything it holds from the
+     * previous one but keeping the storage of its buffers.
+     */
+    void Reset(std::shared_ptr<ServerSession> session, std::shared_ptr<Thread> thread);
+
     /// Returns a pointer to the IPC command buffer for this request.
     u32* CommandBuffer() {
         return cmd_buf.data();
@@ -289,7 +331,8 @@ public:
      * Puts the game thread to sleep and calls the specified async_section asynchronously.
      * Once the execution of the async section finishes, result_function is called. Use this
      * mechanism to run blocking IO operations, so that other game threads are allowed to run
-     * while the one performing the blocking operation waits.
+     * while the one performing the blocking operation waits. The async section is run from the
+     * kernel's async executor, on the queue of the service handling the request.
      * @param async_section Callable that takes Kernel::HLERequestContext& as argument
      * and returns the amount of nanoseconds to wait before calling result_function.
      * This callable is ran asynchronously.
@@ -302,36 +345,14 @@ public:
     template <typename AsyncFunctor, typename ResultFunctor>
     void RunAsync(AsyncFunctor async_section, ResultFunctor result_function,
                   bool really_async = true) {
-
-        if (!Settings::values.deterministic_async_operations && really_async) {
-            kernel.ReportAsyncState(true);
-            this->SleepClientThread(
-                "RunAsync", std::chrono::nanoseconds(-1),
-                std::make_shared<AsyncWakeUpCallback<ResultFunctor>>(
-                    kernel, result_function,
-                    std::move(std::async(std::launch::async, [this, async_section] {
-                        s64 sleep_for = async_section(*this);
-                        this->thread->WakeAfterDelay(sleep_for, true);
-                    }))));
-
-        } else {
-            s64 sleep_for = async_section(*this);
-            if (sleep_for > 0) {
-                kernel.ReportAsyncState(true);
-                auto parallel_wakeup = std::make_shared<AsyncWakeUpCallback<ResultFunctor>>(
-                    kernel, result_function, std::move(std::future<void>()));
-                this->SleepClientThread("RunAsync", std::chrono::nanoseconds(sleep_for),
-                                        parallel_wakeup);
-            } else {
-                result_function(*this);
-            }
-        }
+        RunAsync(session->hle_handler->GetAsyncQueue(kernel), std::move(async_section),
+                 std::move(result_function), really_async);
     }
 
     /**
-     * Same as RunAsync, but runs the async operation on a specific thread worker provided by the
-     * caller.
-     * @param worker The thread worker where the operation will be run.
+     * Same as RunAsync, but runs the async operation on a specific queue provided by the caller,
+     * e.g. to keep the operations of a service in order.
+     * @param queue The async executor queue where the operation will be run.
      * @param async_section Callable that takes Kernel::HLERequestContext& as argument
      * and returns the amount of nanoseconds to wait before calling result_function.
      * This callable is ran asynchronously.
@@ -342,8 +363,8 @@ public:
      * from the emulator thread.
      */
     template <typename AsyncFunctor, typename ResultFunctor>
-    void RunOnThreadWorker(Common::ThreadWorker& worker, AsyncFunctor async_section,
-                           ResultFunctor result_function, bool really_async = true) {
+    void RunAsync(AsyncQueue& queue, AsyncFunctor async_section, ResultFunctor result_function,
+                  bool really_async = true) {
 
         if (!Settings::values.deterministic_async_operations && really_async) {
             kernel.ReportAsyncState(true);
@@ -356,20 +377,19 @@ public:
 
             auto future = task->get_future();
 
-            worker.QueueWork([task]() { (*task)(); });
+            queue.Submit([task]() { (*task)(); });
 
-            this->SleepClientThread("RunOnThread", std::chrono::nanoseconds(-1),
+            this->SleepClientThread("RunAsync", std::chrono::nanoseconds(-1),
                                     std::make_shared<AsyncWakeUpCallback<ResultFunctor>>(
                                         kernel, result_function, std::move(future)));
 
         } else {
-            // Synchronous fallback (same logic as original)
             s64 sleep_for = async_section(*this);
             if (sleep_for > 0) {
                 kernel.ReportAsyncState(true);
                 auto parallel_wakeup = std::make_shared<AsyncWakeUpCallback<ResultFunctor>>(
                     kernel, result_function, std::move(std::future<void>()));
-                this->SleepClientThread("RunOnThread", std::chrono::nanoseconds(sleep_for),
+                this->SleepClientThread("RunAsync", std::chrono::nanoseconds(sleep_for),
                                         parallel_wakeup);
             } else {
                 result_function(*this);
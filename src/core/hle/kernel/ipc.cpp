@@ -104,9 +104,6 @@ Result TranslateCommandBuffer(Kernel::KernelSystem& kernel, Memory::MemorySystem
             IPC::StaticBufferDescInfo bufferInfo{descriptor};
             VAddr static_buffer_src_address = cmd_buf[i];
 
-            std::vector<u8> data(bufferInfo.size);
-            memory.ReadBlock(*src_process, static_buffer_src_address, data.data(), data.size());
-
             // Grab the address that the target thread set up to receive the response static buffer
             // and write our data there. The static buffers area is located right after the command
             // buffer area.
@@ -126,10 +123,12 @@ Result TranslateCommandBuffer(Kernel::KernelSystem& kernel, Memory::MemorySystem
 
             // Note: The real kernel doesn't seem to have any error recovery mechanisms for this
             // case.
-            ASSERT_MSG(target_buffer.descriptor.size >= data.size(),
+            ASSERT_MSG(target_buffer.descriptor.size >= bufferInfo.size,
                        "Static buffer data is too big");
 
-            memory.WriteBlock(*dst_process, target_buffer.address, data.data(), data.size());
+            // Copy the data directly between the two address spaces.
+            memory.CopyBlock(*dst_process, *src_process, target_buffer.address,
+                             static_buffer_src_address, bufferInfo.size);
 
             cmd_buf[i++] = target_buffer.address;
             break;
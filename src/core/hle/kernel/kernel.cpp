@@ -2,12 +2,15 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <thread>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/unordered_map.hpp>
 #include <boost/serialization/vector.hpp>
 #include "common/archives.h"
 #include "common/serialization/atomic.h"
 #include "common/settings.h"
+#include "core/hle/kernel/async_executor.h"
 #include "core/hle/kernel/client_port.h"
 #include "core/hle/kernel/config_mem.h"
 #include "core/hle/kernel/handle_table.h"
@@ -43,6 +46,10 @@ KernelSystem::KernelSystem(Memory::MemorySystem& memory, Core::Timing& timing,
     ipc_recorder = std::make_unique<IPCDebugger::Recorder>();
     stored_processes.assign(num_cores, nullptr);
 
+    // The async sections mostly wait on the host, so a few workers go a long way.
+    const u32 num_async_workers = std::clamp(std::thread::hardware_concurrency() / 2, 2U, 8U);
+    async_executor = std::make_unique<AsyncExecutor>(num_async_workers);
+
     next_thread_id = 1;
 }
 
@@ -131,6 +138,10 @@ const TimerManager& KernelSystem::GetTimerManager() const {
     return *timer_manager;
 }
 
+AsyncExecutor& KernelSystem::GetAsyncExecutor() {
+    return *async_executor;
+}
+
 SharedPage::Handler& KernelSystem::GetSharedPageHandler() {
     return *shared_page_handler;
 }
@@ -47,6 +47,7 @@ class Recorder;
 namespace Kernel {
 
 class AddressArbiter;
+class AsyncExecutor;
 class Event;
 class Mutex;
 class CodeSet;
@@ -335,6 +336,9 @@ public:
     TimerManager& GetTimerManager();
     const TimerManager& GetTimerManager() const;
 
+    /// Returns the host thread pool that runs the blocking sections of HLE service requests.
+    AsyncExecutor& GetAsyncExecutor();
+
     void MapSharedPages(VMManager& address_space);
 
     SharedPage::Handler& GetSharedPageHandler();
@@ -480,6 +484,10 @@ private:
      */
     bool main_thread_extended_sleep = false;
 
+    // Declared last so that it is destroyed first, its workers may still be touching the objects
+    // above.
+    std::unique_ptr<AsyncExecutor> async_executor;
+
     friend class boost::serialization::access;
     template <class Archive>
     void serialize(Archive& ar, const unsigned int);
@@ -20,6 +20,7 @@ namespace Kernel {
 
 class ClientSession;
 class ClientPort;
+class HLERequestContext;
 class ServerSession;
 class Session;
 class SessionRequestHandler;
@@ -106,6 +107,10 @@ private:
     friend class KernelSystem;
     KernelSystem& kernel;
 
+    /// Context of a finished HLE request, reused by the next one to avoid allocations. It holds no
+    /// references while idle, and is not part of the savestate.
+    std::shared_ptr<HLERequestContext> spare_context;
+
     friend class boost::serialization::access;
     template <class Archive>
     void serialize(Archive& ar, const unsigned int);
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <boost/container/small_vector.hpp>
 #include <fmt/format.h>
 #include "common/archives.h"
 #include "common/logging/log.h"
@@ -509,8 +510,16 @@ private:
 
     static const std::array<FunctionDef, 180> SVC_Table;
     static const FunctionDef* GetSVCInfo(u32 func_num);
+
+#if MICROPROFILE_ENABLED
+    /// Per-SVC profiler timers, indexed by SVC number. MicroProfile also counts their calls.
+    std::array<MicroProfileToken, 180> svc_tokens{};
+#endif
 };
 
+/// Most waits are on a handful of objects, keep those off the heap.
+using WaitObjectList = boost::container::small_vector<WaitObject*, 8>;
+
 /// Map application or GSP heap memory
 Result SVC::ControlMemory(u32* out_addr, u32 addr0, u32 addr1, u32 size, u32 operation,
                           u32 permissions) {
@@ -843,23 +852,34 @@ Result SVC::WaitSynchronizationN(s32* out, VAddr handles_address, s32 handle_cou
     // Check if 'handle_count' is invalid
     R_UNLESS(handle_count >= 0, ResultOutOfRange);
 
-    using ObjectPtr = std::shared_ptr<WaitObject>;
-    std::vector<ObjectPtr> objects(handle_count);
+    // Nothing below closes handles, so the objects can be borrowed from the handle table without
+    // touching their reference counts. References are only taken if the thread has to wait.
+    const HandleTable& handle_table = kernel.GetCurrentProcess()->handle_table;
+    WaitObjectList objects(handle_count);
 
     for (int i = 0; i < handle_count; ++i) {
         Handle handle = memory.Read32(handles_address + i * sizeof(Handle));
-        auto object = kernel.GetCurrentProcess()->handle_table.Get<WaitObject>(handle);
+        WaitObject* object = handle_table.GetBorrowed<WaitObject>(handle);
         R_UNLESS(object, ResultInvalidHandle);
         objects[i] = object;
     }
 
+    const auto make_wait_objects = [&objects] {
+        std::vector<std::shared_ptr<WaitObject>> wait_objects;
+        wait_objects.reserve(objects.size());
+        for (WaitObject* object : objects) {
+            wait_objects.push_back(SharedFrom(object));
+        }
+        return wait_objects;
+    };
+
     if (wait_all) {
         bool all_available =
             std::all_of(objects.begin(), objects.end(),
-                        [thread](const ObjectPtr& object) { return !object->ShouldWait(thread); });
+                        [thread](WaitObject* object) { return !object->ShouldWait(thread); });
         if (all_available) {
             // We can acquire all objects right now, do so.
-            for (auto& object : objects)
+            for (WaitObject* object : objects)
                 object->Acquire(thread);
             // Note: In this case, the `out` parameter is not set,
             // and retains whatever value it had before.
@@ -876,11 +896,11 @@ Result SVC::WaitSynchronizationN(s32* out, VAddr handles_address, s32 handle_cou
         thread->status = ThreadStatus::WaitSynchAll;
 
         // Add the thread to each of the objects' waiting threads.
-        for (auto& object : objects) {
+        for (WaitObject* object : objects) {
             object->AddWaitingThread(SharedFrom(thread));
         }
 
-        thread->wait_objects = std::move(objects);
+        thread->wait_objects = make_wait_objects();
 
         // Create an event to wake the thread up after the specified nanosecond delay has passed
         thread->WakeAfterDelay(nano_seconds);
@@ -896,13 +916,13 @@ Result SVC::WaitSynchronizationN(s32* out, VAddr handles_address, s32 handle_cou
         return ResultTimeout;
     } else {
         // Find the first object that is acquirable in the provided list of objects
-        auto itr = std::find_if(objects.begin(), objects.end(), [thread](const ObjectPtr& object) {
+        auto itr = std::find_if(objects.begin(), objects.end(), [thread](WaitObject* object) {
             return !object->ShouldWait(thread);
         });
 
         if (itr != objects.end()) {
             // We found a ready object, acquire it and set the result value
-            WaitObject* object = itr->get();
+            WaitObject* object = *itr;
             object->Acquire(thread);
             *out = static_cast<s32>(std::distance(objects.begin(), itr));
             return ResultSuccess;
@@ -918,12 +938,11 @@ Result SVC::WaitSynchronizationN(s32* out, VAddr handles_address, s32 handle_cou
         thread->status = ThreadStatus::WaitSynchAny;
 
         // Add the thread to each of the objects' waiting threads.
-        for (std::size_t i = 0; i < objects.size(); ++i) {
-            WaitObject* object = objects[i].get();
+        for (WaitObject* object : objects) {
             object->AddWaitingThread(SharedFrom(thread));
         }
 
-        thread->wait_objects = std::move(objects);
+        thread->wait_objects = make_wait_objects();
 
         // Note: If no handles and no timeout were given, then the thread will deadlock, this is
         // consistent with hardware behavior.
@@ -979,8 +998,10 @@ Result SVC::ReplyAndReceive(s32* index, VAddr handles_address, s32 handle_count,
     // Check if 'handle_count' is invalid
     R_UNLESS(handle_count >= 0, ResultOutOfRange);
 
+    // Unlike WaitSynchronizationN, references are held here: translating the reply can close
+    // handles in the current process.
     using ObjectPtr = std::shared_ptr<WaitObject>;
-    std::vector<ObjectPtr> objects(handle_count);
+    boost::container::small_vector<ObjectPtr, 8> objects(handle_count);
 
     std::shared_ptr<Process> current_process = kernel.GetCurrentProcess();
 
@@ -1063,7 +1084,8 @@ Result SVC::ReplyAndReceive(s32* index, VAddr handles_address, s32 handle_count,
         object->AddWaitingThread(SharedFrom(thread));
     }
 
-    thread->wait_objects = std::move(objects);
+    thread->wait_objects.assign(std::make_move_iterator(objects.begin()),
+                                std::make_move_iterator(objects.end()));
 
     thread->wakeup_callback = std::make_shared<SVC_IPCCallback>(system);
 
@@ -2438,9 +2460,12 @@ void SVC::CallSVC(u32 immediate) {
                      "Running threads from exiting processes is unimplemented");
 
     const FunctionDef* info = GetSVCInfo(immediate);
-    LOG_TRACE(Kernel_SVC, "calling {}", info->name);
     if (info) {
+        LOG_TRACE(Kernel_SVC, "calling {}", info->name);
         if (info->func) {
+#if MICROPROFILE_ENABLED
+            MICROPROFILE_SCOPE_TOKEN(svc_tokens[info->id]);
+#endif
             system.GetRunningCore().GetTimer().AddTicks(info->cycles);
             (this->*(info->func))();
         } else {
@@ -2450,7 +2475,16 @@ void SVC::CallSVC(u32 immediate) {
     system.perf_stats->EndSVCProcessing();
 }
 
-SVC::SVC(Core::System& system) : system(system), kernel(system.Kernel()), memory(system.Memory()) {}
+SVC::SVC(Core::System& system) : system(system), kernel(system.Kernel()), memory(system.Memory()) {
+#if MICROPROFILE_ENABLED
+    for (const FunctionDef& info : SVC_Table) {
+        if (info.func) {
+            svc_tokens[info.id] = MicroProfileGetToken("Kernel SVC", info.name, MP_RGB(70, 200, 70),
+                                                       MicroProfileTokenTypeCpu);
+        }
+    }
+#endif
+}
 
 u32 SVC::GetReg(std::size_t n) {
     return system.GetRunningCore().GetReg(static_cast<int>(n));
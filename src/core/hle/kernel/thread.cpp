@@ -194,37 +194,21 @@ Thread* ThreadManager::PopNextReadyThread() {
     Thread* next;
     Thread* thread = GetCurrentThread();
 
-    while (true) {
-        std::vector<std::pair<u32, Thread*>> skipped;
-        u32 next_priority{};
-        next = nullptr;
+    // Threads that cannot be scheduled right now are skipped over in place, keeping their
+    // position in the ready queue.
+    const auto can_schedule = [](Thread* t) { return t->CanSchedule(); };
 
+    while (true) {
         if (thread && thread->status == ThreadStatus::Running && thread->CanSchedule()) {
-            do {
-                // We have to do better than the current thread.
-                // This call returns null when that's not possible.
-                std::tie(next_priority, next) =
-                    ready_queue.pop_first_better(thread->current_priority);
-                if (!next) {
-                    // Otherwise just keep going with the current thread
-                    next = thread;
-                    break;
-                } else if (!next->CanSchedule()) {
-                    skipped.push_back({next_priority, next});
-                }
-
-            } while (!next->CanSchedule());
+            // We have to do better than the current thread.
+            // This call returns null when that's not possible.
+            next = ready_queue.pop_first_better_if(thread->current_priority, can_schedule).second;
+            if (!next) {
+                // Otherwise just keep going with the current thread
+                next = thread;
+            }
         } else {
-            do {
-                std::tie(next_priority, next) = ready_queue.pop_first();
-                if (next && !next->CanSchedule()) {
-                    skipped.push_back({next_priority, next});
-                }
-            } while (next && !next->CanSchedule());
-        }
-
-        for (auto it = skipped.rbegin(); it != skipped.rend(); it++) {
-            ready_queue.push_front(it->first, it->second);
+            next = ready_queue.pop_first_if(can_schedule).second;
         }
 
         // Try to time limit the selected thread on core 1
@@ -78,6 +78,14 @@ inline std::shared_ptr<WaitObject> DynamicObjectCast<WaitObject>(std::shared_ptr
     return nullptr;
 }
 
+template <>
+inline WaitObject* DynamicObjectCast<WaitObject>(Object* object) {
+    if (object != nullptr && object->IsWaitable()) {
+        return static_cast<WaitObject*>(object);
+    }
+    return nullptr;
+}
+
 } // namespace Kernel
 
 BOOST_CLASS_EXPORT_KEY(Kernel::WaitObject)
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <span>
 #include <boost/serialization/unique_ptr.hpp>
 #include "common/archives.h"
 #include "common/logging/log.h"
@@ -53,6 +54,15 @@ File::File(Kernel::KernelSystem& kernel)
     RegisterHandlers(functions);
 }
 
+/// Returns the guest memory that a read of `length` bytes into `buffer` can be done into directly,
+/// or an empty span if the data has to be copied into the buffer afterwards.
+static std::span<u8> GetDestinationSpan(Kernel::MappedBuffer& buffer, std::size_t length) {
+    if (length == 0 || length > buffer.GetSize()) {
+        return {};
+    }
+    return buffer.GetWriteSpan(0, length);
+}
+
 void File::Read(Kernel::HLERequestContext& ctx) {
     IPC::RequestParser rp(ctx);
     u64 offset = rp.Pop<u64>();
@@ -84,13 +94,21 @@ void File::Read(Kernel::HLERequestContext& ctx) {
     if (!allows_cache_reads) {
         auto& buffer = rp.PopMappedBuffer();
         IPC::RequestBuilder rb = rp.MakeBuilder(2, 2);
-        std::unique_ptr<u8[]> data = std::make_unique_for_overwrite<u8[]>(length);
-        const auto read = backend->Read(offset, length, data.get());
+        // Read straight into guest memory when possible.
+        const std::span<u8> guest_data = GetDestinationSpan(buffer, length);
+        std::unique_ptr<u8[]> data;
+        if (guest_data.empty()) {
+            data = std::make_unique_for_overwrite<u8[]>(length);
+        }
+        const auto read =
+            backend->Read(offset, length, guest_data.empty() ? data.get() : guest_data.data());
         if (read.Failed()) {
             rb.Push(read.Code());
             rb.Push<u32>(0);
         } else {
-            buffer.Write(data.get(), 0, *read);
+            if (data) {
+                buffer.Write(data.get(), 0, *read);
+            }
             rb.Push(ResultSuccess);
             rb.Push<u32>(static_cast<u32>(*read));
         }
@@ -111,12 +129,16 @@ void File::Read(Kernel::HLERequestContext& ctx) {
         // Output
         Result ret{0};
         Kernel::MappedBuffer* buffer;
+        std::span<u8> guest_data;
         std::unique_ptr<u8[]> data;
         std::size_t read_size;
     };
 
     auto async_data = std::make_shared<AsyncData>();
     async_data->buffer = &rp.PopMappedBuffer();
+    // The guest memory is looked up here, the async section may run on another host thread.
+    // Surfaces created over it in the meantime are invalidated once the read completes.
+    async_data->guest_data = GetDestinationSpan(*async_data->buffer, length);
     async_data->length = length;
     async_data->offset = offset;
     async_data->cache_ready = backend->CacheReady(offset, length);
@@ -128,9 +150,12 @@ void File::Read(Kernel::HLERequestContext& ctx) {
     // LOG_DEBUG(Service_FS, "cache={}, offset={}, length={}", cache_ready, offset, length);
     ctx.RunAsync(
         [this, async_data](Kernel::HLERequestContext& ctx) {
-            async_data->data = std::make_unique_for_overwrite<u8[]>(async_data->length);
-            const auto read =
-                backend->Read(async_data->offset, async_data->length, async_data->data.get());
+            u8* dest = async_data->guest_data.data();
+            if (async_data->guest_data.empty()) {
+                async_data->data = std::make_unique_for_overwrite<u8[]>(async_data->length);
+                dest = async_data->data.get();
+            }
+            const auto read = backend->Read(async_data->offset, async_data->length, dest);
             if (read.Failed()) {
                 async_data->ret = read.Code();
                 async_data->read_size = 0;
@@ -161,7 +186,11 @@ void File::Read(Kernel::HLERequestContext& ctx) {
                 rb.Push(async_data->ret);
                 rb.Push<u32>(0);
             } else {
-                async_data->buffer->Write(async_data->data.get(), 0, async_data->read_size);
+                if (async_data->data) {
+                    async_data->buffer->Write(async_data->data.get(), 0, async_data->read_size);
+                } else {
+                    async_data->buffer->InvalidateWritten(0, async_data->read_size);
+                }
                 rb.Push(ResultSuccess);
                 rb.Push<u32>(static_cast<u32>(async_data->read_size));
             }
@@ -194,10 +223,16 @@ void File::Write(Kernel::HLERequestContext& ctx) {
 
     // Do not use asynchronous fs operations here for the same reason as File::Read.
     if (!backend->AllowsCachedReads()) {
-        std::vector<u8> data(length);
-        buffer.Read(data.data(), 0, data.size());
+        // Write straight from guest memory when possible.
+        std::span<const u8> guest_data = buffer.GetReadSpan(0, length);
+        std::vector<u8> data;
+        if (guest_data.empty()) {
+            data.resize(length);
+            buffer.Read(data.data(), 0, data.size());
+            guest_data = data;
+        }
         ResultVal<std::size_t> written =
-            backend->Write(offset, data.size(), flush, update_timestamp, data.data());
+            backend->Write(offset, guest_data.size(), flush, update_timestamp, guest_data.data());
 
         // Update file size
         file->size = backend->GetSize();
@@ -220,6 +255,7 @@ void File::Write(Kernel::HLERequestContext& ctx) {
         bool flush;
         bool update_timestamp;
         Kernel::MappedBuffer* buffer;
+        std::span<const u8> guest_data;
         FileSessionSlot* file;
 
         // Output
@@ -231,14 +267,23 @@ void File::Write(Kernel::HLERequestContext& ctx) {
     async_data->flush = flush;
     async_data->update_timestamp = update_timestamp;
     async_data->buffer = &buffer;
+    // The guest span is captured here and only read from on the async thread, which writes it
+    // straight to the backend.
+    async_data->guest_data = buffer.GetReadSpan(0, length);
     async_data->file = file;
 
     ctx.RunAsync(
         [this, async_data](Kernel::HLERequestContext& ctx) {
-            std::vector<u8> data(async_data->length);
-            async_data->buffer->Read(data.data(), 0, data.size());
-            async_data->written = backend->Write(async_data->offset, data.size(), async_data->flush,
-                                                 async_data->update_timestamp, data.data());
+            std::span<const u8> source = async_data->guest_data;
+            std::vector<u8> data;
+            if (source.empty()) {
+                data.resize(async_data->length);
+                async_data->buffer->Read(data.data(), 0, data.size());
+                source = data;
+            }
+            async_data->written =
+                backend->Write(async_data->offset, source.size(), async_data->flush,
+                               async_data->update_timestamp, source.data());
 
             // Update file size
             async_data->file->size = backend->GetSize();
@@ -23,6 +23,7 @@
 #include "core/hle/kernel/client_port.h"
 #include "core/hle/kernel/client_session.h"
 #include "core/hle/kernel/event.h"
+#include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/process.h"
 #include "core/hle/kernel/server_session.h"
 #include "core/hle/result.h"
@@ -100,8 +101,8 @@ void FS_USER::OpenFile(Kernel::HLERequestContext& ctx) {
     async_data->attributes = attributes;
     async_data->pre_timer = std::chrono::steady_clock::now();
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->file =
                 archives.OpenFileFromArchive(async_data->archive_handle, async_data->file_path,
@@ -204,8 +205,8 @@ void FS_USER::OpenFileDirectly(Kernel::HLERequestContext& ctx) {
     async_data->attributes = attributes;
     async_data->pre_timer = std::chrono::steady_clock::now();
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->archive_handle = archives.OpenArchive(
                 async_data->archive_id, async_data->archive_path, async_data->program_id);
@@ -277,8 +278,8 @@ void FS_USER::DeleteFile(Kernel::HLERequestContext& ctx) {
     async_data->archive_handle = archive_handle;
     async_data->file_path = file_path;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res =
                 archives.DeleteFileFromArchive(async_data->archive_handle, async_data->file_path);
@@ -336,8 +337,8 @@ void FS_USER::RenameFile(Kernel::HLERequestContext& ctx) {
     async_data->dest_archive_handle = dest_archive_handle;
     async_data->dest_file_path = dest_file_path;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = archives.RenameFileBetweenArchives(
                 async_data->src_archive_handle, async_data->src_file_path,
@@ -382,8 +383,8 @@ void FS_USER::DeleteDirectory(Kernel::HLERequestContext& ctx) {
     async_data->archive_handle = archive_handle;
     async_data->dir_path = dir_path;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = archives.DeleteDirectoryFromArchive(async_data->archive_handle,
                                                                   async_data->dir_path);
@@ -427,8 +428,8 @@ void FS_USER::DeleteDirectoryRecursively(Kernel::HLERequestContext& ctx) {
     async_data->archive_handle = archive_handle;
     async_data->dir_path = dir_path;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = archives.DeleteDirectoryRecursivelyFromArchive(
                 async_data->archive_handle, async_data->dir_path);
@@ -478,8 +479,8 @@ void FS_USER::CreateFile(Kernel::HLERequestContext& ctx) {
     async_data->file_size = file_size;
     async_data->attributes = attributes;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res =
                 archives.CreateFileInArchive(async_data->archive_handle, async_data->file_path,
@@ -525,8 +526,8 @@ void FS_USER::CreateDirectory(Kernel::HLERequestContext& ctx) {
     async_data->dir_path = dir_path;
     async_data->attributes = attributes;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = archives.CreateDirectoryFromArchive(
                 async_data->archive_handle, async_data->dir_path, async_data->attributes);
@@ -583,8 +584,8 @@ void FS_USER::RenameDirectory(Kernel::HLERequestContext& ctx) {
     async_data->dest_archive_handle = dest_archive_handle;
     async_data->dest_dir_path = dest_dir_path;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = archives.RenameDirectoryBetweenArchives(
                 async_data->src_archive_handle, async_data->src_dir_path,
@@ -639,8 +640,8 @@ void FS_USER::OpenDirectory(Kernel::HLERequestContext& ctx) {
     async_data->archive_handle = archive_handle;
     async_data->dir_path = dir_path;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->dir_res =
                 archives.OpenDirectoryFromArchive(async_data->archive_handle, async_data->dir_path);
@@ -709,8 +710,8 @@ void FS_USER::OpenArchive(Kernel::HLERequestContext& ctx) {
     async_data->archive_path = archive_path;
     async_data->program_id = program_id;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->handle = archives.OpenArchive(
                 async_data->archive_id, async_data->archive_path, async_data->program_id);
@@ -777,8 +778,8 @@ void FS_USER::ControlArchive(Kernel::HLERequestContext& ctx) {
     async_data->in_buffer = &rp.PopMappedBuffer();
     async_data->out_buffer = &rp.PopMappedBuffer();
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             std::vector<u8> in_data(async_data->in_size);
             async_data->in_buffer->Read(in_data.data(), 0, in_data.size());
@@ -818,8 +819,8 @@ void FS_USER::CloseArchive(Kernel::HLERequestContext& ctx) {
     auto async_data = std::make_shared<AsyncData>();
     async_data->handle = archive_handle;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = archives.CloseArchive(async_data->handle);
             return 0;
@@ -1429,8 +1430,8 @@ void FS_USER::ObsoletedSetSaveDataSecureValue(Kernel::HLERequestContext& ctx) {
     async_data->unique_id = unique_id;
     async_data->title_variation = title_variation;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = secure_value_backend->ObsoletedSetSaveDataSecureValue(
                 async_data->unique_id, async_data->title_variation, async_data->secure_value_slot,
@@ -1477,8 +1478,8 @@ void FS_USER::ObsoletedGetSaveDataSecureValue(Kernel::HLERequestContext& ctx) {
     async_data->unique_id = unique_id;
     async_data->title_variation = title_variation;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = secure_value_backend->ObsoletedGetSaveDataSecureValue(
                 async_data->unique_id, async_data->title_variation, async_data->secure_value_slot);
@@ -1542,8 +1543,8 @@ void FS_USER::SetThisSaveDataSecureValue(Kernel::HLERequestContext& ctx) {
     async_data->value = value;
     async_data->secure_value_slot = secure_value_slot;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = secure_value_backend->SetThisSaveDataSecureValue(
                 async_data->secure_value_slot, async_data->value);
@@ -1585,8 +1586,8 @@ void FS_USER::GetThisSaveDataSecureValue(Kernel::HLERequestContext& ctx) {
     auto async_data = std::make_shared<AsyncData>();
     async_data->secure_value_slot = secure_value_slot;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res =
                 secure_value_backend->GetThisSaveDataSecureValue(async_data->secure_value_slot);
@@ -1637,8 +1638,8 @@ void FS_USER::SetSaveDataSecureValue(Kernel::HLERequestContext& ctx) {
     async_data->secure_value_slot = secure_value_slot;
     async_data->flush = flush;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = archives.SetSaveDataSecureValue(async_data->archive_handle,
                                                               async_data->secure_value_slot,
@@ -1683,8 +1684,8 @@ void FS_USER::GetSaveDataSecureValue(Kernel::HLERequestContext& ctx) {
     async_data->archive_handle = archive_handle;
     async_data->secure_value_slot = secure_value_slot;
 
-    ctx.RunOnThreadWorker(
-        fs_async_worker,
+    ctx.RunAsync(
+        *fs_async_queue,
         [this, async_data](Kernel::HLERequestContext& ctx) {
             async_data->res = archives.GetSaveDataSecureValue(async_data->archive_handle,
                                                               async_data->secure_value_slot);
@@ -1789,7 +1790,9 @@ ResultVal<u16> FS_USER::GetSpecialContentIndexFromTMD(MediaType media_type, u64
 }
 
 FS_USER::FS_USER(Core::System& system)
-    : ServiceFramework("fs:USER", 30), system(system), archives(system.ArchiveManager()) {
+    : ServiceFramework("fs:USER", 30), system(system), archives(system.ArchiveManager()),
+      // Archive operations are not thread-safe, keep them in submission order.
+      fs_async_queue(system.Kernel().GetAsyncExecutor().CreateQueue(1)) {
     static const FunctionInfo functions[] = {
         // clang-format off
         {0x0001, nullptr, "Dummy1"},
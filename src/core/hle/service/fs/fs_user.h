@@ -50,7 +50,7 @@ class FS_USER final : public ServiceFramework<FS_USER, ClientSlot> {
 public:
     explicit FS_USER(Core::System& system);
     ~FS_USER() {
-        fs_async_worker.WaitForRequests();
+        fs_async_queue->WaitIdle();
     }
 
     // On real HW this is part of FSReg (FSReg:Register). But since that module is only used by
@@ -759,7 +759,7 @@ private:
 
     std::shared_ptr<FileSys::SecureValueBackend> secure_value_backend;
 
-    Common::ThreadWorker fs_async_worker{1, "FSUSER_Worker"};
+    std::shared_ptr<Kernel::AsyncQueue> fs_async_queue;
 
     template <class Archive>
     void serialize(Archive& ar, const unsigned int);
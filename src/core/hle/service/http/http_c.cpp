@@ -2348,6 +2348,8 @@ HTTP_C::HTTP_C() : ServiceFramework("http:C", 32) {
         // clang-format on
     };
     RegisterHandlers(functions);
+    // Requests without a timeout wait for the download to finish, however long it takes.
+    UseDedicatedAsyncThreads();
 
     DecryptClCertA();
 }
@@ -2249,6 +2249,8 @@ SOC_U::SOC_U() : ServiceFramework("soc:U", 18) {
     };
 
     RegisterHandlers(functions);
+    // accept, connect, poll and blocking receives wait on the host for as long as the peer takes.
+    UseDedicatedAsyncThreads();
 
     Network::SocketManager::EnableSockets();
 }
@@ -169,122 +169,137 @@ public:
         return system.GetRunningCore().GetPC();
     }
 
-    template <bool UNSAFE>
-    void ReadBlockImpl(const Kernel::Process& process, const VAddr src_addr, void* dest_buffer,
-                       const std::size_t size) {
-        auto& page_table = *process.vm_manager.page_table;
+    /// Classes of pages that can be accessed in one go when adjacent to each other.
+    enum class RunType {
+        Unmapped,
+        Memory,
+        RasterizerCached,
+    };
 
+    /// A span of pages of the same class that is contiguous in both guest and host memory.
+    struct PageRun {
+        RunType type;
+        VAddr vaddr;
+        u8* pointer;
+        std::size_t size;
+    };
+
+    /// Returns the run class and host pointer of the byte at vaddr, which lies in page_index.
+    std::pair<RunType, u8*> GetPageRunInfo(PageTable& page_table, std::size_t page_index,
+                                           VAddr vaddr) {
+        const std::size_t page_offset = vaddr & CITRA_PAGE_MASK;
+        switch (page_table.attributes[page_index]) {
+        case PageType::Unmapped:
+            return {RunType::Unmapped, nullptr};
+        case PageType::Memory:
+            DEBUG_ASSERT(page_table.pointers[page_index]);
+            return {RunType::Memory, page_table.pointers[page_index] + page_offset};
+        case PageType::MemoryWatchpoint: {
+            auto it = page_table.watchpoint_pages_map.find(page_index);
+            ASSERT_MSG(it != page_table.watchpoint_pages_map.end(),
+                       "Missing memory for watchpoint page");
+            return {RunType::Memory, it->second.memory.GetPtr() + page_offset};
+        }
+        case PageType::RasterizerCachedMemory:
+        case PageType::RasterizerCachedMemoryWatchpoint:
+            return {RunType::RasterizerCached, GetPointerForRasterizerCache(vaddr).GetPtr()};
+        default:
+            UNREACHABLE();
+        }
+        return {RunType::Unmapped, nullptr};
+    }
+
+    /**
+     * Splits [addr, addr + size) into runs of pages that share the same class and are contiguous
+     * in host memory, and calls func once per run. Block operations can then memcpy and flush
+     * whole runs at once instead of handling every page separately.
+     */
+    template <typename Func>
+    void ForEachPageRun(PageTable& page_table, VAddr addr, std::size_t size, Func&& func) {
         std::size_t remaining_size = size;
-        std::size_t page_index = src_addr >> CITRA_PAGE_BITS;
-        std::size_t page_offset = src_addr & CITRA_PAGE_MASK;
+        std::size_t page_index = addr >> CITRA_PAGE_BITS;
+        std::size_t page_offset = addr & CITRA_PAGE_MASK;
+        PageRun run{RunType::Unmapped, addr, nullptr, 0};
 
         while (remaining_size > 0) {
             const std::size_t copy_amount = std::min(CITRA_PAGE_SIZE - page_offset, remaining_size);
             const VAddr current_vaddr =
                 static_cast<VAddr>((page_index << CITRA_PAGE_BITS) + page_offset);
+            const auto [type, pointer] = GetPageRunInfo(page_table, page_index, current_vaddr);
+
+            if (run.size != 0 &&
+                (type != run.type || (pointer != nullptr && pointer != run.pointer + run.size))) {
+                func(run);
+                run.size = 0;
+            }
+            if (run.size == 0) {
+                run = PageRun{type, current_vaddr, pointer, 0};
+            }
+            run.size += copy_amount;
+
+            page_index++;
+            page_offset = 0;
+            remaining_size -= copy_amount;
+        }
+
+        if (run.size != 0) {
+            func(run);
+        }
+    }
 
-            switch (page_table.attributes[page_index]) {
-            case PageType::Unmapped: {
+    template <bool UNSAFE>
+    void ReadBlockImpl(const Kernel::Process& process, const VAddr src_addr, void* dest_buffer,
+                       const std::size_t size) {
+        u8* dest = static_cast<u8*>(dest_buffer);
+        ForEachPageRun(*process.vm_manager.page_table, src_addr, size, [&](const PageRun& run) {
+            switch (run.type) {
+            case RunType::Unmapped:
                 LOG_ERROR(
                     HW_Memory,
                     "unmapped ReadBlock @ 0x{:08X} (start address = 0x{:08X}, size = {}) at PC "
                     "0x{:08X}",
-                    current_vaddr, src_addr, size, GetPC());
-                std::memset(dest_buffer, 0, copy_amount);
+                    run.vaddr, src_addr, size, GetPC());
+                std::memset(dest, 0, run.size);
                 break;
-            }
-            case PageType::Memory: {
-                DEBUG_ASSERT(page_table.pointers[page_index]);
-
-                const u8* src_ptr = page_table.pointers[page_index] + page_offset;
-                std::memcpy(dest_buffer, src_ptr, copy_amount);
-                break;
-            }
-            case PageType::MemoryWatchpoint: {
-                auto it = page_table.watchpoint_pages_map.find(page_index);
-                ASSERT_MSG(it != page_table.watchpoint_pages_map.end(),
-                           "Missing memory for watchpoint page");
-
-                const u8* src_ptr = it->second.memory.GetPtr() + page_offset;
-                std::memcpy(dest_buffer, src_ptr, copy_amount);
-                break;
-            }
-            case PageType::RasterizerCachedMemory:
-            case PageType::RasterizerCachedMemoryWatchpoint: {
+            case RunType::RasterizerCached:
                 if constexpr (!UNSAFE) {
-                    RasterizerFlushVirtualRegion(current_vaddr, static_cast<u32>(copy_amount),
+                    RasterizerFlushVirtualRegion(run.vaddr, static_cast<u32>(run.size),
                                                  FlushMode::Flush);
                 }
-                std::memcpy(dest_buffer, GetPointerForRasterizerCache(current_vaddr), copy_amount);
+                [[fallthrough]];
+            case RunType::Memory:
+                std::memcpy(dest, run.pointer, run.size);
                 break;
             }
-            default:
-                UNREACHABLE();
-            }
-
-            page_index++;
-            page_offset = 0;
-            dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
-            remaining_size -= copy_amount;
-        }
+            dest += run.size;
+        });
     }
 
     template <bool UNSAFE>
     void WriteBlockImpl(const Kernel::Process& process, const VAddr dest_addr,
                         const void* src_buffer, const std::size_t size) {
-        auto& page_table = *process.vm_manager.page_table;
-        std::size_t remaining_size = size;
-        std::size_t page_index = dest_addr >> CITRA_PAGE_BITS;
-        std::size_t page_offset = dest_addr & CITRA_PAGE_MASK;
-
-        while (remaining_size > 0) {
-            const std::size_t copy_amount = std::min(CITRA_PAGE_SIZE - page_offset, remaining_size);
-            const VAddr current_vaddr =
-                static_cast<VAddr>((page_index << CITRA_PAGE_BITS) + page_offset);
-
-            switch (page_table.attributes[page_index]) {
-            case PageType::Unmapped: {
+        const u8* src = static_cast<const u8*>(src_buffer);
+        ForEachPageRun(*process.vm_manager.page_table, dest_addr, size, [&](const PageRun& run) {
+            switch (run.type) {
+            case RunType::Unmapped:
                 LOG_ERROR(
                     HW_Memory,
                     "unmapped WriteBlock @ 0x{:08X} (start address = 0x{:08X}, size = {}) at PC "
                     "0x{:08X}",
-                    current_vaddr, dest_addr, size, GetPC());
-                break;
-            }
-            case PageType::Memory: {
-                DEBUG_ASSERT(page_table.pointers[page_index]);
-
-                u8* dest_ptr = page_table.pointers[page_index] + page_offset;
-                std::memcpy(dest_ptr, src_buffer, copy_amount);
+                    run.vaddr, dest_addr, size, GetPC());
                 break;
-            }
-            case PageType::MemoryWatchpoint: {
-                auto it = page_table.watchpoint_pages_map.find(page_index);
-                ASSERT_MSG(it != page_table.watchpoint_pages_map.end(),
-                           "Missing memory for watchpoint page");
-
-                u8* dest_ptr = it->second.memory.GetPtr() + page_offset;
-                std::memcpy(dest_ptr, src_buffer, copy_amount);
-                break;
-            }
-            case PageType::RasterizerCachedMemory:
-            case PageType::RasterizerCachedMemoryWatchpoint: {
+            case RunType::RasterizerCached:
                 if constexpr (!UNSAFE) {
-                    RasterizerFlushVirtualRegion(current_vaddr, static_cast<u32>(copy_amount),
+                    RasterizerFlushVirtualRegion(run.vaddr, static_cast<u32>(run.size),
                                                  FlushMode::Invalidate);
                 }
-                std::memcpy(GetPointerForRasterizerCache(current_vaddr), src_buffer, copy_amount);
+                [[fallthrough]];
+            case RunType::Memory:
+                std::memcpy(run.pointer, src, run.size);
                 break;
             }
-            default:
-                UNREACHABLE();
-            }
-
-            page_index++;
-            page_offset = 0;
-            src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
-            remaining_size -= copy_amount;
-        }
+            src += run.size;
+        });
     }
 
     MemoryRef GetPointerForRasterizerCache(VAddr addr) const {
@@ -1154,55 +1169,43 @@ void MemorySystem::WriteBlock(const VAddr dest_addr, const void* src_buffer,
 
 void MemorySystem::ZeroBlock(const Kernel::Process& process, const VAddr dest_addr,
                              const std::size_t size) {
+    using PageRun = Impl::PageRun;
+    using RunType = Impl::RunType;
     auto& page_table = *process.vm_manager.page_table;
-    std::size_t remaining_size = size;
-    std::size_t page_index = dest_addr >> CITRA_PAGE_BITS;
-    std::size_t page_offset = dest_addr & CITRA_PAGE_MASK;
-
-    while (remaining_size > 0) {
-        const std::size_t copy_amount = std::min(CITRA_PAGE_SIZE - page_offset, remaining_size);
-        const VAddr current_vaddr =
-            static_cast<VAddr>((page_index << CITRA_PAGE_BITS) + page_offset);
-
-        switch (page_table.attributes[page_index]) {
-        case PageType::Unmapped: {
+    impl->ForEachPageRun(page_table, dest_addr, size, [&](const PageRun& run) {
+        switch (run.type) {
+        case RunType::Unmapped:
             LOG_ERROR(HW_Memory,
                       "unmapped ZeroBlock @ 0x{:08X} (start address = 0x{:08X}, size = {}) at PC "
                       "0x{:08X}",
-                      current_vaddr, dest_addr, size, impl->GetPC());
+                      run.vaddr, dest_addr, size, impl->GetPC());
             break;
-        }
-        case PageType::Memory: {
-            DEBUG_ASSERT(page_table.pointers[page_index]);
-
-            u8* dest_ptr = page_table.pointers[page_index] + page_offset;
-            std::memset(dest_ptr, 0, copy_amount);
-            break;
-        }
-        case PageType::MemoryWatchpoint: {
-            auto it = page_table.watchpoint_pages_map.find(page_index);
-            ASSERT_MSG(it != page_table.watchpoint_pages_map.end(),
-                       "Missing memory for watchpoint page");
-
-            u8* dest_ptr = it->second.memory.GetPtr() + page_offset;
-            std::memset(dest_ptr, 0, copy_amount);
-            break;
-        }
-        case PageType::RasterizerCachedMemory:
-        case PageType::RasterizerCachedMemoryWatchpoint: {
-            RasterizerFlushVirtualRegion(current_vaddr, static_cast<u32>(copy_amount),
+        case RunType::RasterizerCached:
+            RasterizerFlushVirtualRegion(run.vaddr, static_cast<u32>(run.size),
                                          FlushMode::Invalidate);
-            std::memset(GetPointerForRasterizerCache(current_vaddr), 0, copy_amount);
+            [[fallthrough]];
+        case RunType::Memory:
+            std::memset(run.pointer, 0, run.size);
             break;
         }
-        default:
-            UNREACHABLE();
-        }
+    });
+}
 
-        page_index++;
-        page_offset = 0;
-        remaining_size -= copy_amount;
-    }
+std::span<u8> MemorySystem::GetBlockSpan(const Kernel::Process& process, const VAddr addr,
+                                         const std::size_t size) {
+    using PageRun = Impl::PageRun;
+    using RunType = Impl::RunType;
+    std::span<u8> span;
+    auto& page_table = *process.vm_manager.page_table;
+    impl->ForEachPageRun(page_table, addr, size, [&](const PageRun& run) {
+        // A single run of plain memory covering the whole range is the only thing that can be
+        // handed out, rasterizer cached memory would need to be flushed or invalidated around
+        // every access.
+        if (run.type == RunType::Memory && run.size == size) {
+            span = {run.pointer, size};
+        }
+    });
+    return span;
 }
 
 void MemorySystem::CopyBlock(const Kernel::Process& process, VAddr dest_addr, VAddr src_addr,
@@ -1213,58 +1216,27 @@ void MemorySystem::CopyBlock(const Kernel::Process& process, VAddr dest_addr, VA
 void MemorySystem::CopyBlock(const Kernel::Process& dest_process,
                              const Kernel::Process& src_process, VAddr dest_addr, VAddr src_addr,
                              std::size_t size) {
+    using PageRun = Impl::PageRun;
+    using RunType = Impl::RunType;
     auto& page_table = *src_process.vm_manager.page_table;
-    std::size_t remaining_size = size;
-    std::size_t page_index = src_addr >> CITRA_PAGE_BITS;
-    std::size_t page_offset = src_addr & CITRA_PAGE_MASK;
-
-    while (remaining_size > 0) {
-        const std::size_t copy_amount = std::min(CITRA_PAGE_SIZE - page_offset, remaining_size);
-        const VAddr current_vaddr =
-            static_cast<VAddr>((page_index << CITRA_PAGE_BITS) + page_offset);
-
-        switch (page_table.attributes[page_index]) {
-        case PageType::Unmapped: {
+    impl->ForEachPageRun(page_table, src_addr, size, [&](const PageRun& run) {
+        switch (run.type) {
+        case RunType::Unmapped:
             LOG_ERROR(HW_Memory,
                       "unmapped CopyBlock @ 0x{:08X} (start address = 0x{:08X}, size = {}) at PC "
                       "0x{:08X}",
-                      current_vaddr, src_addr, size, impl->GetPC());
-            ZeroBlock(dest_process, dest_addr, copy_amount);
+                      run.vaddr, src_addr, size, impl->GetPC());
+            ZeroBlock(dest_process, dest_addr, run.size);
             break;
-        }
-        case PageType::Memory: {
-            DEBUG_ASSERT(page_table.pointers[page_index]);
-            const u8* src_ptr = page_table.pointers[page_index] + page_offset;
-            WriteBlock(dest_process, dest_addr, src_ptr, copy_amount);
+        case RunType::RasterizerCached:
+            RasterizerFlushVirtualRegion(run.vaddr, static_cast<u32>(run.size), FlushMode::Flush);
+            [[fallthrough]];
+        case RunType::Memory:
+            WriteBlock(dest_process, dest_addr, run.pointer, run.size);
             break;
         }
-        case PageType::MemoryWatchpoint: {
-            auto it = page_table.watchpoint_pages_map.find(page_index);
-            ASSERT_MSG(it != page_table.watchpoint_pages_map.end(),
-                       "Missing memory for watchpoint page");
-
-            const u8* src_ptr = it->second.memory.GetPtr() + page_offset;
-            WriteBlock(dest_process, dest_addr, src_ptr, copy_amount);
-            break;
-        }
-        case PageType::RasterizerCachedMemory:
-        case PageType::RasterizerCachedMemoryWatchpoint: {
-            RasterizerFlushVirtualRegion(current_vaddr, static_cast<u32>(copy_amount),
-                                         FlushMode::Flush);
-            WriteBlock(dest_process, dest_addr, GetPointerForRasterizerCache(current_vaddr),
-                       copy_amount);
-            break;
-        }
-        default:
-            UNREACHABLE();
-        }
-
-        page_index++;
-        page_offset = 0;
-        dest_addr += static_cast<VAddr>(copy_amount);
-        src_addr += static_cast<VAddr>(copy_amount);
-        remaining_size -= copy_amount;
-    }
+        dest_addr += static_cast<VAddr>(run.size);
+    });
 }
 
 u32 MemorySystem::GetFCRAMOffset(const u8* pointer) const {
@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <optional>
+#include <span>
 #include <string>
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/vector.hpp>
@@ -650,6 +651,20 @@ public:
     void CopyBlock(const Kernel::Process& dest_process, const Kernel::Process& src_process,
                    VAddr dest_addr, VAddr src_addr, std::size_t size);
 
+    /**
+     * Gets a host view of a range of a process' address space, so that it can be accessed without
+     * going through an intermediate buffer.
+     *
+     * @param process The process whose address space is viewed.
+     * @param addr    The virtual address of the start of the range.
+     * @param size    The size of the range, in bytes.
+     *
+     * @returns A span over the range, or an empty span if the range is not entirely backed by
+     *          contiguous host memory, or if any part of it is unmapped or cached by the
+     *          rasterizer. Those ranges have to be accessed with ReadBlock/WriteBlock instead.
+     */
+    std::span<u8> GetBlockSpan(const Kernel::Process& process, VAddr addr, std::size_t size);
+
     /**
      * Marks each page within the specified address range as cached or uncached.
      *
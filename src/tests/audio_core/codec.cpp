@@ -0,0 +1,86 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <cstring>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "audio_core/codec.h"
+
+namespace AudioCore {
+
+// Lengths which exercise both the vectorized loops and their scalar tails.
+static constexpr std::array<std::size_t, 5> test_lengths{0, 1, 15, 16, 37};
+
+TEST_CASE("Codec::DecodePCM8", "[audio_core]") {
+    for (const unsigned num_channels : {1u, 2u}) {
+        for (const std::size_t sample_count : test_lengths) {
+            std::vector<u8> data(sample_count * num_channels);
+            for (std::size_t i = 0; i < data.size(); i++) {
+                data[i] = static_cast<u8>(i * 37 + 11);
+            }
+
+            StereoBuffer16 output;
+            Codec::DecodePCM8(num_channels, data.data(), sample_count, output);
+
+            REQUIRE(output.size() == sample_count);
+            for (std::size_t i = 0; i < sample_count; i++) {
+                const s16 left = static_cast<s16>(data[i * num_channels] << 8);
+                const s16 right = static_cast<s16>(data[i * num_channels + num_channels - 1] << 8);
+                REQUIRE(output[i][0] == left);
+                REQUIRE(output[i][1] == right);
+            }
+        }
+    }
+}
+
+TEST_CASE("Codec::DecodePCM16", "[audio_core]") {
+    for (const unsigned num_channels : {1u, 2u}) {
+        for (const std::size_t sample_count : test_lengths) {
+            std::vector<s16> samples(sample_count * num_channels);
+            for (std::size_t i = 0; i < samples.size(); i++) {
+                samples[i] = static_cast<s16>(i * 2749 - 30000);
+            }
+            std::vector<u8> data(samples.size() * sizeof(s16));
+            std::memcpy(data.data(), samples.data(), data.size());
+
+            StereoBuffer16 output;
+            Codec::DecodePCM16(num_channels, data.data(), sample_count, output);
+
+            REQUIRE(output.size() == sample_count);
+            for (std::size_t i = 0; i < sample_count; i++) {
+                REQUIRE(output[i][0] == samples[i * num_channels]);
+                REQUIRE(output[i][1] == samples[i * num_channels + num_channels - 1]);
+            }
+        }
+    }
+}
+
+TEST_CASE("StereoBuffer16", "[audio_core]") {
+    StereoBuffer16 buffer;
+    auto samples = buffer.Reset(3);
+    samples[0] = {1, 1};
+    samples[1] = {2, 2};
+    samples[2] = {3, 3};
+
+    // More history than the room kept in front makes the buffer grow.
+    std::vector<StereoBuffer16::Sample> history(10);
+    for (std::size_t i = 0; i < history.size(); i++) {
+        history[i].fill(static_cast<s16>(static_cast<int>(i) - 9));
+    }
+    buffer.PushFront(history);
+    REQUIRE(buffer.size() == 13);
+    for (std::size_t i = 0; i < buffer.size(); i++) {
+        REQUIRE(buffer[i][0] == static_cast<s16>(i) - 9);
+    }
+
+    buffer.PopFront(11);
+    REQUIRE(buffer.size() == 2);
+    REQUIRE(buffer[0][1] == 2);
+
+    buffer.PopFront(2);
+    REQUIRE(buffer.empty());
+}
+
+} // namespace AudioCore
@@ -0,0 +1,105 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <vector>
+#include "audio_core/interpolate.h"
+
+namespace AudioCore {
+
+namespace {
+
+constexpr std::size_t predelay = 4;
+
+/// Resamples a signal with polyphase interpolation, feeding it in buffers of 100 samples.
+std::vector<std::array<s16, 2>> ResamplePolyphase(float rate, std::size_t num_frames,
+                                                  const auto& signal) {
+    AudioInterp::State state;
+    StereoBuffer16 input;
+    std::size_t input_position = 0;
+    std::vector<std::array<s16, 2>> ret;
+
+    for (std::size_t frame = 0; frame < num_frames; frame++) {
+        StereoFrame16 output{};
+        std::size_t outputi = 0;
+        while (outputi < output.size()) {
+            if (input.empty()) {
+                for (auto& sample : input.Reset(100)) {
+                    sample = signal(input_position++);
+                }
+            }
+            AudioInterp::Polyphase(state, input, rate, output, outputi);
+        }
+        ret.insert(ret.end(), output.begin(), output.end());
+    }
+    return ret;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("AudioInterp::Polyphase passes the input through at rate 1", "[audio_core]") {
+    const auto signal = [](std::size_t i) {
+        return std::array<s16, 2>{static_cast<s16>(i * 7919), static_cast<s16>(-i * 104729)};
+    };
+    const auto output = ResamplePolyphase(1.0f, 4, signal);
+
+    for (std::size_t i = predelay; i < output.size(); i++) {
+        REQUIRE(output[i] == signal(i - predelay));
+    }
+}
+
+TEST_CASE("AudioInterp::Polyphase follows a band-limited signal", "[audio_core]") {
+    const auto sine = [](double position) { return 10000.0 * std::sin(position * 0.05); };
+    const auto signal = [&](std::size_t i) {
+        const s16 value = static_cast<s16>(std::lround(sine(static_cast<double>(i))));
+        return std::array<s16, 2>{value, static_cast<s16>(-value)};
+    };
+
+    for (const float rate : {0.5f, 0.75f, 1.2f, 1.7f, 2.5f}) {
+        const auto output = ResamplePolyphase(rate, 8, signal);
+        for (std::size_t i = 0; i < output.size(); i++) {
+            // Skip the samples whose filter window still overlaps the zeroed initial history.
+            const double position = i * static_cast<double>(rate) - predelay;
+            if (position < predelay) {
+                continue;
+            }
+            const double expected = sine(position);
+            REQUIRE(std::abs(output[i][0] - expected) < 20.0);
+            REQUIRE(std::abs(output[i][1] + expected) < 20.0);
+        }
+    }
+}
+
+TEST_CASE("AudioInterp[Benchmark]", "[.][audio_core][benchmark]") {
+    StereoBuffer16 input;
+    StereoFrame16 output;
+    AudioInterp::State state;
+
+    // One frame of output at a rate which needs a fresh input buffer for every call.
+    constexpr float rate = 1.3f;
+    const auto refill = [&] {
+        for (auto& sample : input.Reset(256)) {
+            sample = {1234, -1234};
+        }
+    };
+
+    BENCHMARK("Linear") {
+        refill();
+        std::size_t outputi = 0;
+        AudioInterp::Linear(state, input, rate, output, outputi);
+        return outputi;
+    };
+
+    BENCHMARK("Polyphase") {
+        refill();
+        std::size_t outputi = 0;
+        AudioInterp::Polyphase(state, input, rate, output, outputi);
+        return outputi;
+    };
+}
+
+} // namespace AudioCore
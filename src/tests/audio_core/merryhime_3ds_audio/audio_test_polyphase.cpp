@@ -0,0 +1,100 @@
+#include <vector>
+#include <catch2/catch_template_test_macros.hpp>
+#include "audio_core/hle/shared_memory.h"
+#include "common/settings.h"
+#include "merry_audio/merry_audio.h"
+
+TEST_CASE_METHOD(MerryAudio::MerryAudioFixture, "AudioTest-PolyphaseInterpolation",
+                 "[audio_core][merryhime_3ds_audio]") {
+    // Constant signal, PCM16. Resampling must keep it at the same level.
+    constexpr s32 level = 0x1000;
+    constexpr size_t NUM_SAMPLES = 160 * 200;
+    u32* audio_buffer = (u32*)linearAlloc(NUM_SAMPLES * sizeof(u32));
+    for (size_t i = 0; i < NUM_SAMPLES; i++) {
+        audio_buffer[i] = (level << 16) | level;
+    }
+    DSP_FlushDataCache(audio_buffer, NUM_SAMPLES);
+
+    MerryAudio::AudioState state;
+    {
+        std::vector<u8> dspfirm;
+        // The polyphase filters of the firmware have not been reverse engineered, so only the
+        // HLE implementation is held to this expectation. It is opt-in until it is validated.
+        Settings::values.enable_polyphase_interpolation = true;
+        SECTION("HLE") {
+            // The test case assumes HLE AudioCore doesn't require a valid firmware
+            InitDspCore(Settings::AudioEmulation::HLE);
+            dspfirm = {0};
+        }
+        auto ret = audioInit(dspfirm);
+        if (!ret) {
+            INFO("Couldn't init audio\n");
+            goto end;
+        }
+        state = *ret;
+    }
+
+    {
+        state.waitForSync();
+        initSharedMem(state);
+        state.write().dsp_configuration->aux_bus_enable_0_dirty.Assign(true);
+        state.write().dsp_configuration->aux_bus_enable[0] = true;
+        state.write().source_configurations->config[0].gain[1][0] = 1.0;
+        state.write().source_configurations->config[0].gain_1_dirty.Assign(true);
+        state.write().source_configurations->config[0].interpolation_mode =
+            AudioCore::HLE::SourceConfiguration::Configuration::InterpolationMode::Polyphase;
+        state.write().source_configurations->config[0].interpolation_dirty.Assign(true);
+        state.write().source_configurations->config[0].rate_multiplier = 0.75;
+        state.write().source_configurations->config[0].rate_multiplier_dirty.Assign(true);
+        state.notifyDsp();
+        state.waitForSync();
+
+        {
+            state.write().source_configurations->config[0].play_position = 0;
+            state.write().source_configurations->config[0].physical_address =
+                osConvertVirtToPhys(audio_buffer);
+            state.write().source_configurations->config[0].length = NUM_SAMPLES;
+            state.write().source_configurations->config[0].mono_or_stereo.Assign(
+                AudioCore::HLE::SourceConfiguration::Configuration::MonoOrStereo::Mono);
+            state.write().source_configurations->config[0].format.Assign(
+                AudioCore::HLE::SourceConfiguration::Configuration::Format::PCM16);
+            state.write().source_configurations->config[0].fade_in.Assign(false);
+            state.write().source_configurations->config[0].adpcm_dirty.Assign(false);
+            state.write().source_configurations->config[0].is_looping.Assign(false);
+            state.write().source_configurations->config[0].buffer_id = 1;
+            state.write().source_configurations->config[0].partial_reset_flag.Assign(true);
+            state.write().source_configurations->config[0].play_position_dirty.Assign(true);
+            state.write().source_configurations->config[0].embedded_buffer_dirty.Assign(true);
+
+            state.write().source_configurations->config[0].enable = true;
+            state.write().source_configurations->config[0].enable_dirty.Assign(true);
+            state.notifyDsp();
+
+            // Collect a few frames of output from the first non-silent sample on.
+            std::vector<s32> output;
+            for (size_t frame_count = 0; output.size() < 160 * 3 && frame_count < 10;
+                 frame_count++) {
+                state.waitForSync();
+
+                for (size_t i = 0; i < 160; i++) {
+                    const s32 sample = state.read().intermediate_mix_samples->mix1.pcm32[0][i];
+                    if (sample || !output.empty()) {
+                        output.push_back(sample);
+                    }
+                }
+
+                state.notifyDsp();
+            }
+            REQUIRE(output.size() >= 160 * 3);
+
+            // The first samples are filtered together with the silence preceding the signal.
+            for (size_t i = 16; i < output.size(); i++) {
+                REQUIRE(output[i] == level);
+            }
+        }
+    }
+
+end:
+    audioExit(state);
+    Settings::values.enable_polyphase_interpolation = false;
+}
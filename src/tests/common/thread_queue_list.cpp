@@ -0,0 +1,39 @@
+// Copyright 2026 Citra Emulator Project / Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <catch2/catch_test_macros.hpp>
+#include "common/thread_queue_list.h"
+
+namespace Common {
+
+TEST_CASE("ThreadQueueList", "[common]") {
+    ThreadQueueList<int*, 64> queue;
+    int a = 0, b = 1, c = 2, d = 3;
+
+    queue.prepare(40);
+    queue.prepare(10);
+    queue.prepare(63);
+    queue.push_back(40, &a);
+    queue.push_back(10, &b);
+    queue.push_back(10, &c);
+    queue.push_back(63, &d);
+
+    REQUIRE(queue.get_first() == &b);
+
+    // Skipped entries keep their place in the queue.
+    const auto skip_b = [&](int* entry) { return entry != &b; };
+    REQUIRE(queue.pop_first_if(skip_b) == std::make_pair(10u, &c));
+    REQUIRE(queue.get_first() == &b);
+
+    // Nothing better than priority 10 can be scheduled.
+    REQUIRE(queue.pop_first_better_if(10, skip_b).second == nullptr);
+    REQUIRE(queue.pop_first_better(11) == std::make_pair(10u, &b));
+
+    queue.remove(40, &a);
+    REQUIRE(queue.pop_first() == std::make_pair(63u, &d));
+    REQUIRE(queue.get_first() == nullptr);
+    REQUIRE(queue.pop_first().second == nullptr);
+}
+
+} // namespace Common
@@ -0,0 +1,120 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "core/arm/dynarmic/arm_idle_loop.h"
+#include "core/core.h"
+#include "core/core_timing.h"
+#include "core/hle/kernel/process.h"
+#include "core/memory.h"
+
+using Core::ClassifyIdleLoopInstruction;
+using Kind = Core::IdleLoopInstructionKind;
+
+namespace {
+
+constexpr u32 LDR_R1_R0 = 0xE5901000;     // ldr r1, [r0]
+constexpr u32 STR_R1_R0 = 0xE5801000;     // str r1, [r0]
+constexpr u32 CMP_R1_0 = 0xE3510000;      // cmp r1, #0
+constexpr u32 MOVNE_PC_LR = 0x11A0F00E;   // movne pc, lr
+constexpr u32 LDMNE_SP_R4_PC = 0x18BD8010; // ldmne sp!, {r4, pc}
+
+/// Maps a page of heap memory to write the code under test into.
+class IdleLoopFixture {
+public:
+    IdleLoopFixture()
+        : memory{system}, kernel{memory, timing, [] {}, Kernel::MemoryMode::NewProd, 1} {
+        process = kernel.CreateProcess(kernel.CreateCodeSet("", 0));
+        REQUIRE(process->vm_manager
+                    .MapBackingMemory(Memory::HEAP_VADDR, page, page_size,
+                                      Kernel::MemoryState::Private)
+                    .Code() == ResultSuccess);
+        memory.SetCurrentPageTable(process->vm_manager.page_table);
+    }
+
+    std::size_t FindLength(const std::vector<u32>& code, u32 pc_index,
+                           bool allow_sleep_svc = false) {
+        memory.WriteBlock(*process, Memory::HEAP_VADDR, code.data(), code.size() * sizeof(u32));
+        return Core::FindIdleLoopLength(memory, Memory::HEAP_VADDR + pc_index * 4,
+                                        allow_sleep_svc);
+    }
+
+private:
+    static constexpr u32 page_size = static_cast<u32>(Memory::CITRA_PAGE_SIZE);
+
+    Core::Timing timing{1, 100};
+    Core::System system;
+    Memory::MemorySystem memory;
+    Kernel::KernelSystem kernel;
+    std::shared_ptr<Kernel::Process> process;
+    MemoryRef page{std::make_shared<BufferMem>(page_size)};
+};
+
+} // Anonymous namespace
+
+TEST_CASE("ClassifyIdleLoopInstruction: Loads and compares are pure", "[core][arm]") {
+    CHECK(ClassifyIdleLoopInstruction(LDR_R1_R0, false) == Kind::Pure);
+    CHECK(ClassifyIdleLoopInstruction(CMP_R1_0, false) == Kind::Pure);
+    CHECK(ClassifyIdleLoopInstruction(0xE1A00001, false) == Kind::Pure); // mov r0, r1
+    CHECK(ClassifyIdleLoopInstruction(0xE320F000, false) == Kind::Pure); // nop
+    CHECK(ClassifyIdleLoopInstruction(0xE1C020D0, false) == Kind::Pure); // ldrd r2, [r0]
+    CHECK(ClassifyIdleLoopInstruction(0xE0020190, false) == Kind::Pure); // mul r2, r0, r1
+    CHECK(ClassifyIdleLoopInstruction(0xE8900006, false) == Kind::Pure); // ldm r0, {r1, r2}
+}
+
+TEST_CASE("ClassifyIdleLoopInstruction: Stores and calls have side effects", "[core][arm]") {
+    CHECK(ClassifyIdleLoopInstruction(STR_R1_R0, false) == Kind::SideEffect);
+    CHECK(ClassifyIdleLoopInstruction(0xE12FFF1E, false) == Kind::SideEffect); // bx lr
+    CHECK(ClassifyIdleLoopInstruction(0xEB000000, false) == Kind::SideEffect); // bl
+    CHECK(ClassifyIdleLoopInstruction(0xE8800006, false) == Kind::SideEffect); // stm r0, {r1, r2}
+    CHECK(ClassifyIdleLoopInstruction(0xEAFFFFFE, false) == Kind::Branch);     // b .
+}
+
+TEST_CASE("ClassifyIdleLoopInstruction: Writing PC is a side effect", "[core][arm]") {
+    CHECK(ClassifyIdleLoopInstruction(0xE1A0F00E, false) == Kind::SideEffect); // mov pc, lr
+    CHECK(ClassifyIdleLoopInstruction(0xE08FF000, false) == Kind::SideEffect); // add pc, pc, r0
+    CHECK(ClassifyIdleLoopInstruction(0xE590F000, false) == Kind::SideEffect); // ldr pc, [r0]
+    CHECK(ClassifyIdleLoopInstruction(0xE8BD8010, false) == Kind::SideEffect); // ldm sp!, {r4, pc}
+    CHECK(ClassifyIdleLoopInstruction(0xE1C0E0D0, false) == Kind::SideEffect); // ldrd lr, [r0]
+    CHECK(ClassifyIdleLoopInstruction(0xE00F0190, false) == Kind::SideEffect); // mul pc, r0, r1
+}
+
+TEST_CASE("ClassifyIdleLoopInstruction: svcSleepThread is only pure when allowed", "[core][arm]") {
+    constexpr u32 svc_sleep_thread = 0xEF00000A;
+    CHECK(ClassifyIdleLoopInstruction(svc_sleep_thread, true) == Kind::Pure);
+    CHECK(ClassifyIdleLoopInstruction(svc_sleep_thread, false) == Kind::SideEffect);
+    CHECK(ClassifyIdleLoopInstruction(0xEF000001, true) == Kind::SideEffect);
+}
+
+TEST_CASE("FindIdleLoopLength: Polling loops are detected", "[core][arm]") {
+    IdleLoopFixture fixture;
+    const std::vector<u32> code{LDR_R1_R0, CMP_R1_0, 0x0AFFFFFC}; // beq to the ldr
+    CHECK(fixture.FindLength(code, 0) == 3);
+    CHECK(fixture.FindLength(code, 2) == 3);
+}
+
+TEST_CASE("FindIdleLoopLength: Loops with stores are rejected", "[core][arm]") {
+    IdleLoopFixture fixture;
+    const std::vector<u32> code{LDR_R1_R0, STR_R1_R0, CMP_R1_0, 0x0AFFFFFB};
+    CHECK(fixture.FindLength(code, 0) == 0);
+    CHECK(fixture.FindLength(code, 3) == 0);
+}
+
+TEST_CASE("FindIdleLoopLength: Conditional exits are allowed", "[core][arm]") {
+    IdleLoopFixture fixture;
+    // bne leaves the loop forwards, b closes it
+    const std::vector<u32> code{LDR_R1_R0, CMP_R1_0, 0x1A000000, 0xEAFFFFFB};
+    CHECK(fixture.FindLength(code, 0) == 4);
+
+    // An unconditional forward branch never reaches the end of the loop
+    const std::vector<u32> always_exits{LDR_R1_R0, CMP_R1_0, 0xEA000000, 0xEAFFFFFB};
+    CHECK(fixture.FindLength(always_exits, 0) == 0);
+}
+
+TEST_CASE("FindIdleLoopLength: Loops writing PC are rejected", "[core][arm]") {
+    IdleLoopFixture fixture;
+    CHECK(fixture.FindLength({LDR_R1_R0, CMP_R1_0, MOVNE_PC_LR, 0xEAFFFFFB}, 0) == 0);
+    CHECK(fixture.FindLength({LDR_R1_R0, CMP_R1_0, LDMNE_SP_R4_PC, 0xEAFFFFFB}, 0) == 0);
+}
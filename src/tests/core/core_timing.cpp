@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
@@ -196,4 +197,82 @@ TEST_CASE("CoreTiming[ChainScheduling]", "[core]") {
     REQUIRE(MAX_SLICE_LENGTH == timing.GetTimer(0)->GetDowncount());
 }
 
+TEST_CASE("CoreTiming[UnscheduleKeepsOrder]", "[core]") {
+    Core::Timing timing(1, 100);
+
+    Core::TimingEventType* cb_a = timing.RegisterEvent("callbackA", CallbackTemplate<0>);
+    Core::TimingEventType* cb_b = timing.RegisterEvent("callbackB", CallbackTemplate<1>);
+    Core::TimingEventType* cb_c = timing.RegisterEvent("callbackC", CallbackTemplate<2>);
+    Core::TimingEventType* cb_d = timing.RegisterEvent("callbackD", CallbackTemplate<3>);
+    Core::TimingEventType* cb_e = timing.RegisterEvent("callbackE", CallbackTemplate<4>);
+
+    // Enter slice 0
+    timing.GetTimer(0)->Advance();
+    timing.GetTimer(0)->SetNextSlice();
+
+    timing.ScheduleEvent(100, cb_a, CB_IDS[0], 0);
+    timing.ScheduleEvent(200, cb_b, CB_IDS[1], 0);
+    timing.ScheduleEvent(300, cb_c, CB_IDS[2], 0);
+    timing.ScheduleEvent(400, cb_d, CB_IDS[3], 0);
+    timing.ScheduleEvent(500, cb_e, CB_IDS[4], 0);
+
+    // Removing from the root and from the middle of the heap must leave it well ordered.
+    timing.UnscheduleEvent(cb_a, CB_IDS[0]);
+    timing.UnscheduleEvent(cb_c, CB_IDS[2]);
+    // Mismatched user data must not remove anything.
+    timing.UnscheduleEvent(cb_d, CB_IDS[0]);
+
+    AdvanceAndCheck(timing, 1, 200, 0, -100);
+    AdvanceAndCheck(timing, 3, 100);
+    AdvanceAndCheck(timing, 4, MAX_SLICE_LENGTH);
+}
+
+TEST_CASE("CoreTiming[RemoveEventKeepsOrder]", "[core]") {
+    Core::Timing timing(1, 100);
+
+    Core::TimingEventType* cb_a = timing.RegisterEvent("callbackA", CallbackTemplate<0>);
+    Core::TimingEventType* cb_b = timing.RegisterEvent("callbackB", CallbackTemplate<1>);
+    Core::TimingEventType* cb_d = timing.RegisterEvent("callbackD", CallbackTemplate<3>);
+
+    // Enter slice 0
+    timing.GetTimer(0)->Advance();
+    timing.GetTimer(0)->SetNextSlice();
+
+    timing.ScheduleEvent(100, cb_a, CB_IDS[0], 0);
+    timing.ScheduleEvent(200, cb_b, CB_IDS[1], 0);
+    timing.ScheduleEvent(300, cb_a, CB_IDS[0], 0);
+    timing.ScheduleEvent(400, cb_d, CB_IDS[3], 0);
+    timing.ScheduleEvent(500, cb_a, CB_IDS[0], 0);
+
+    // Removing several events at once must leave the heap well ordered.
+    timing.RemoveEvent(cb_a);
+
+    AdvanceAndCheck(timing, 1, 200, 0, -100);
+    AdvanceAndCheck(timing, 3, MAX_SLICE_LENGTH);
+}
+
+TEST_CASE("CoreTiming[Benchmark]", "[.][core][benchmark]") {
+    Core::Timing timing(1, 100);
+
+    static constexpr std::size_t NUM_EVENTS = 64;
+    Core::TimingEventType* cb = timing.RegisterEvent("callbackBench", [](std::uintptr_t, s64) {});
+
+    // Enter slice 0
+    timing.GetTimer(0)->Advance();
+    timing.GetTimer(0)->SetNextSlice();
+
+    BENCHMARK("Schedule, unschedule half and dispatch") {
+        for (std::size_t i = 0; i < NUM_EVENTS; ++i) {
+            timing.ScheduleEvent(static_cast<s64>((i * 7919) % 1000 + 1), cb, i, 0);
+        }
+        for (std::size_t i = 0; i < NUM_EVENTS; i += 2) {
+            timing.UnscheduleEvent(cb, i);
+        }
+        timing.GetTimer(0)->AddTicks(1000);
+        timing.GetTimer(0)->Advance();
+        timing.GetTimer(0)->SetNextSlice();
+        return timing.GetTimer(0)->GetDowncount();
+    };
+}
+
 // TODO: Add tests for multiple timers
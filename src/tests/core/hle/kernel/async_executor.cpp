@@ -0,0 +1,96 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <atomic>
+#include <future>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "core/hle/kernel/async_executor.h"
+
+namespace Kernel {
+
+TEST_CASE("AsyncExecutor[SerialQueue]", "[core][kernel]") {
+    AsyncExecutor executor{4};
+    auto queue = executor.CreateQueue(1);
+
+    std::vector<int> order;
+    for (int i = 0; i < 100; ++i) {
+        queue->Submit([&order, i] { order.push_back(i); });
+    }
+    queue->WaitIdle();
+
+    REQUIRE(order.size() == 100);
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(order[i] == i);
+    }
+}
+
+TEST_CASE("AsyncExecutor[ConcurrentQueues]", "[core][kernel]") {
+    AsyncExecutor executor{3};
+    auto first = executor.CreateQueue(2);
+    auto second = executor.CreateQueue(2);
+
+    std::atomic<int> count{0};
+    for (int i = 0; i < 50; ++i) {
+        first->Submit([&count] { ++count; });
+        second->Submit([&count] { ++count; });
+    }
+    first->WaitIdle();
+    second->WaitIdle();
+
+    REQUIRE(count == 100);
+}
+
+TEST_CASE("AsyncExecutor[SubmitDoesNotBlock]", "[core][kernel]") {
+    AsyncExecutor executor{1};
+    auto queue = executor.CreateQueue(1);
+
+    // Submitting from the emulation thread must not wait for the queue to drain.
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> count{0};
+    queue->Submit([released] { released.wait(); });
+    for (int i = 0; i < 1000; ++i) {
+        queue->Submit([&count] { ++count; });
+    }
+    release.set_value();
+    queue->WaitIdle();
+
+    REQUIRE(count == 1000);
+}
+
+TEST_CASE("AsyncExecutor[DedicatedQueue]", "[core][kernel]") {
+    AsyncExecutor executor{1};
+    auto queue = executor.CreateDedicatedQueue();
+
+    // Like a socket accept waiting for a connect from the same process, the first task can only
+    // finish once the second one has run.
+    std::promise<void> connected;
+    std::shared_future<void> accepted = connected.get_future().share();
+    bool first_done = false;
+    queue->Submit([accepted, &first_done] {
+        accepted.wait();
+        first_done = true;
+    });
+    queue->Submit([&connected] { connected.set_value(); });
+    queue->WaitIdle();
+
+    REQUIRE(first_done);
+}
+
+TEST_CASE("AsyncExecutor[SubmitAfterShutdown]", "[core][kernel]") {
+    std::shared_ptr<AsyncQueue> queue;
+    {
+        AsyncExecutor executor{2};
+        queue = executor.CreateQueue(1);
+    }
+
+    bool ran = false;
+    queue->Submit([&ran] { ran = true; });
+    queue->WaitIdle();
+
+    REQUIRE(ran);
+}
+
+} // namespace Kernel
@@ -2,6 +2,8 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <atomic>
+#include <future>
 #include <catch2/catch_test_macros.hpp>
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -398,4 +400,46 @@ TEST_CASE("HLERequestContext::WriteToOutgoingCommandBuffer", "[core][kernel]") {
     }
 }
 
+namespace {
+
+class BlockingHandler final : public SessionRequestHandler {
+public:
+    BlockingHandler() {
+        UseDedicatedAsyncThreads();
+    }
+
+    void HandleSyncRequest(HLERequestContext& context) override {}
+
+protected:
+    std::unique_ptr<SessionDataBase> MakeSessionData() override {
+        return std::make_unique<SessionDataBase>();
+    }
+};
+
+} // Anonymous namespace
+
+TEST_CASE("SessionRequestHandler::GetAsyncQueue runs blocking requests concurrently",
+          "[core][kernel]") {
+    Core::Timing timing(1, 100);
+    Core::System system;
+    Memory::MemorySystem memory{system};
+    Kernel::KernelSystem kernel(memory, timing, [] {}, Kernel::MemoryMode::NewProd, 1);
+    auto handler = std::make_shared<BlockingHandler>();
+    AsyncQueue& queue = handler->GetAsyncQueue(kernel);
+
+    // Two requests of the same handler, e.g. accept and connect on a loopback socket. The first
+    // one only returns once the second one has run, whatever the number of async workers.
+    std::promise<void> connected;
+    std::shared_future<void> accepted = connected.get_future().share();
+    std::atomic<bool> accept_done{false};
+    queue.Submit([accepted, &accept_done] {
+        accepted.wait();
+        accept_done = true;
+    });
+    queue.Submit([&connected] { connected.set_value(); });
+    queue.WaitIdle();
+
+    REQUIRE(accept_done);
+}
+
 } // namespace Kernel
@@ -2,6 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -53,3 +56,83 @@ TEST_CASE("memory.IsValidVirtualAddress", "[core][memory]") {
         CHECK(memory.IsValidVirtualAddress(*process, Memory::CONFIG_MEMORY_VADDR) == false);
     }
 }
+
+TEST_CASE("memory.BlockOperationsAcrossPages", "[core][memory]") {
+    Core::Timing timing(1, 100);
+    Core::System system;
+    Memory::MemorySystem memory{system};
+    Kernel::KernelSystem kernel(memory, timing, [] {}, Kernel::MemoryMode::NewProd, 1);
+    auto process = kernel.CreateProcess(kernel.CreateCodeSet("", 0));
+
+    // Two separately allocated pages so the range is not contiguous in host memory.
+    constexpr u32 page_size = static_cast<u32>(Memory::CITRA_PAGE_SIZE);
+    MemoryRef first{std::make_shared<BufferMem>(page_size)};
+    MemoryRef second{std::make_shared<BufferMem>(page_size)};
+    REQUIRE(process->vm_manager
+                .MapBackingMemory(Memory::HEAP_VADDR, first, page_size,
+                                  Kernel::MemoryState::Private)
+                .Code() == ResultSuccess);
+    REQUIRE(process->vm_manager
+                .MapBackingMemory(Memory::HEAP_VADDR + page_size, second, page_size,
+                                  Kernel::MemoryState::Private)
+                .Code() == ResultSuccess);
+
+    std::vector<u8> pattern(page_size);
+    for (std::size_t i = 0; i < pattern.size(); ++i) {
+        pattern[i] = static_cast<u8>(i * 7 + 1);
+    }
+
+    const VAddr straddle = Memory::HEAP_VADDR + page_size / 2;
+    memory.WriteBlock(*process, straddle, pattern.data(), pattern.size());
+    CHECK(std::memcmp(first.GetPtr() + page_size / 2, pattern.data(), page_size / 2) == 0);
+    CHECK(std::memcmp(second.GetPtr(), pattern.data() + page_size / 2, page_size / 2) == 0);
+
+    std::vector<u8> readback(pattern.size());
+    memory.ReadBlock(*process, straddle, readback.data(), readback.size());
+    CHECK(readback == pattern);
+
+    memory.CopyBlock(*process, Memory::HEAP_VADDR, straddle, page_size / 2);
+    CHECK(std::memcmp(first.GetPtr(), pattern.data(), page_size / 2) == 0);
+
+    memory.ZeroBlock(*process, straddle, pattern.size());
+    CHECK(std::all_of(second.GetPtr(), second.GetPtr() + page_size / 2,
+                      [](u8 b) { return b == 0; }));
+}
+
+TEST_CASE("memory.GetBlockSpan", "[core][memory]") {
+    Core::Timing timing(1, 100);
+    Core::System system;
+    Memory::MemorySystem memory{system};
+    Kernel::KernelSystem kernel(memory, timing, [] {}, Kernel::MemoryMode::NewProd, 1);
+    auto process = kernel.CreateProcess(kernel.CreateCodeSet("", 0));
+
+    constexpr u32 page_size = static_cast<u32>(Memory::CITRA_PAGE_SIZE);
+    MemoryRef contiguous{std::make_shared<BufferMem>(2 * page_size)};
+    MemoryRef separate{std::make_shared<BufferMem>(page_size)};
+    REQUIRE(process->vm_manager
+                .MapBackingMemory(Memory::HEAP_VADDR, contiguous, 2 * page_size,
+                                  Kernel::MemoryState::Private)
+                .Code() == ResultSuccess);
+    REQUIRE(process->vm_manager
+                .MapBackingMemory(Memory::HEAP_VADDR + 2 * page_size, separate, page_size,
+                                  Kernel::MemoryState::Private)
+                .Code() == ResultSuccess);
+
+    SECTION("contiguous pages") {
+        const auto span = memory.GetBlockSpan(*process, Memory::HEAP_VADDR + 16, page_size);
+        CHECK(span.data() == contiguous.GetPtr() + 16);
+        CHECK(span.size() == page_size);
+    }
+
+    SECTION("pages that are not contiguous in host memory") {
+        const auto span =
+            memory.GetBlockSpan(*process, Memory::HEAP_VADDR + page_size + 16, page_size);
+        CHECK(span.empty());
+    }
+
+    SECTION("unmapped pages") {
+        const auto span =
+            memory.GetBlockSpan(*process, Memory::HEAP_VADDR + 2 * page_size, 2 * page_size);
+        CHECK(span.empty());
+    }
+}
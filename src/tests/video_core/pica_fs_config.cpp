@@ -0,0 +1,106 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <memory>
+#include <catch2/catch_test_macros.hpp>
+#include "video_core/pica/regs_internal.h"
+#include "video_core/shader/generator/pica_fs_config.h"
+
+using Pica::Shader::FSConfig;
+using TevStageConfig = Pica::TexturingRegs::TevStageConfig;
+
+namespace {
+
+u64 CanonicalHash(const Pica::RegsInternal& regs) {
+    FSConfig config{regs};
+    config.Canonicalize();
+    return config.Hash();
+}
+
+std::unique_ptr<Pica::RegsInternal> MakeRegs() {
+    auto regs = std::make_unique<Pica::RegsInternal>();
+    // Lighting is disabled by default on hardware
+    regs->lighting.disable.Assign(1);
+    return regs;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("FSConfig: Unused TEV operands are ignored", "[video_core]") {
+    auto regs = MakeRegs();
+    auto& stage = regs->texturing.tev_stage1;
+    stage.color_op.Assign(TevStageConfig::Operation::Replace);
+    stage.color_source1.Assign(TevStageConfig::Source::Texture0);
+    const u64 base = CanonicalHash(*regs);
+
+    stage.color_source2.Assign(TevStageConfig::Source::Texture1);
+    stage.color_modifier3.Assign(TevStageConfig::ColorModifier::OneMinusSourceBlue);
+    REQUIRE(CanonicalHash(*regs) == base);
+
+    // The second operand is read by Modulate
+    stage.color_op.Assign(TevStageConfig::Operation::Modulate);
+    const u64 modulate = CanonicalHash(*regs);
+    REQUIRE(modulate != base);
+    stage.color_source2.Assign(TevStageConfig::Source::Texture2);
+    REQUIRE(CanonicalHash(*regs) != modulate);
+}
+
+TEST_CASE("FSConfig: The first stage keeps its third source for the previous output",
+          "[video_core]") {
+    auto regs = MakeRegs();
+    auto& stage = regs->texturing.tev_stage0;
+    stage.color_op.Assign(TevStageConfig::Operation::Modulate);
+    stage.color_source1.Assign(TevStageConfig::Source::Previous);
+    stage.color_source3.Assign(TevStageConfig::Source::Texture0);
+    const u64 base = CanonicalHash(*regs);
+
+    stage.color_source3.Assign(TevStageConfig::Source::Texture1);
+    REQUIRE(CanonicalHash(*regs) != base);
+}
+
+TEST_CASE("FSConfig: Passthrough stages share a config", "[video_core]") {
+    auto regs = MakeRegs();
+    auto& stage = regs->texturing.tev_stage2;
+    stage.color_source1.Assign(TevStageConfig::Source::Previous);
+    stage.alpha_source1.Assign(TevStageConfig::Source::Previous);
+    const u64 base = CanonicalHash(*regs);
+
+    stage.color_source2.Assign(TevStageConfig::Source::Constant);
+    stage.alpha_modifier2.Assign(TevStageConfig::AlphaModifier::OneMinusSourceRed);
+    stage.color_scale.Assign(3);
+    REQUIRE(CanonicalHash(*regs) == base);
+
+    stage.color_scale.Assign(1);
+    REQUIRE(CanonicalHash(*regs) != base);
+}
+
+TEST_CASE("FSConfig: Only border wrap modes are kept", "[video_core]") {
+    using WrapMode = Pica::TexturingRegs::TextureConfig::WrapMode;
+    auto regs = MakeRegs();
+    regs->texturing.texture0.type.Assign(Pica::TexturingRegs::TextureConfig::Texture2D);
+    regs->texturing.texture0.wrap_s.Assign(WrapMode::Repeat);
+    const u64 base = CanonicalHash(*regs);
+
+    regs->texturing.texture0.wrap_s.Assign(WrapMode::MirroredRepeat);
+    REQUIRE(CanonicalHash(*regs) == base);
+
+    regs->texturing.texture0.wrap_s.Assign(WrapMode::ClampToBorder);
+    REQUIRE(CanonicalHash(*regs) != base);
+}
+
+TEST_CASE("FSConfig: LUTs unsupported by the lighting config are ignored", "[video_core]") {
+    using LightingRegs = Pica::LightingRegs;
+    auto regs = MakeRegs();
+    regs->lighting.disable.Assign(0);
+    // Config0 has no Distribution1 LUT
+    regs->lighting.config0.config.Assign(LightingRegs::LightingConfig::Config0);
+    regs->lighting.lut_scale.d1.Assign(LightingRegs::LightingScale::Scale2);
+    const u64 base = CanonicalHash(*regs);
+
+    regs->lighting.lut_scale.d1.Assign(LightingRegs::LightingScale::Scale4);
+    REQUIRE(CanonicalHash(*regs) == base);
+
+    regs->lighting.lut_scale.d0.Assign(LightingRegs::LightingScale::Scale4);
+    REQUIRE(CanonicalHash(*regs) != base);
+}
@@ -0,0 +1,250 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <vector>
+#include <tsl/robin_map.h>
+#include "common/hash.h"
+#include "video_core/rasterizer_cache/surface_page_table.h"
+
+using VideoCore::SurfaceId;
+using VideoCore::SurfacePageTable;
+
+namespace {
+
+constexpr PAddr VRAM_ADDR = 0x18000000;
+constexpr PAddr FCRAM_ADDR = 0x20000000;
+constexpr u32 TABLE_PAGE_SIZE = 1U << SurfacePageTable::PAGE_BITS;
+
+bool Contains(std::span<const SurfaceId> surfaces, SurfaceId surface_id) {
+    return std::find(surfaces.begin(), surfaces.end(), surface_id) != surfaces.end();
+}
+
+/// Surface operation as issued by the rasterizer cache.
+struct Operation {
+    enum class Type : u8 {
+        Register,
+        Unregister,
+        Lookup,
+    };
+    Type type;
+    PAddr addr;
+    u32 size;
+    SurfaceId surface_id;
+};
+
+/**
+ * Builds a trace shaped like the cache traffic of a game with a large texture working set:
+ * a few framebuffers in VRAM looked up every draw, and textures streamed in and out of FCRAM.
+ */
+std::vector<Operation> MakeTrace() {
+    using Type = Operation::Type;
+    static constexpr u32 NUM_FRAMES = 8;
+    static constexpr u32 NUM_TEXTURES = 2048;
+    static constexpr u32 DRAWS_PER_FRAME = 512;
+
+    std::vector<Operation> trace;
+    u32 next_id = 0;
+    const std::array<Operation, 3> framebuffers{{
+        {Type::Register, VRAM_ADDR, 400 * 240 * 4, SurfaceId{next_id++}},
+        {Type::Register, VRAM_ADDR + 0x100000, 400 * 240 * 4, SurfaceId{next_id++}},
+        {Type::Register, VRAM_ADDR + 0x200000, 320 * 240 * 4, SurfaceId{next_id++}},
+    }};
+    trace.insert(trace.end(), framebuffers.begin(), framebuffers.end());
+
+    std::vector<Operation> textures;
+    for (u32 i = 0; i < NUM_TEXTURES; i++) {
+        const u32 size = (64 << (i % 4)) * (64 << (i % 4)) * 2;
+        const PAddr addr = FCRAM_ADDR + ((i * 0x9E3779B1U) % 0x4000000 & ~0xFFFU);
+        textures.push_back({Type::Register, addr, size, SurfaceId{next_id++}});
+        trace.push_back(textures.back());
+    }
+
+    for (u32 frame = 0; frame < NUM_FRAMES; frame++) {
+        for (u32 draw = 0; draw < DRAWS_PER_FRAME; draw++) {
+            const Operation& framebuffer = framebuffers[draw % 2];
+            const Operation& texture = textures[(frame * 131 + draw * 17) % NUM_TEXTURES];
+            trace.push_back({Type::Lookup, framebuffer.addr, framebuffer.size, {}});
+            trace.push_back({Type::Lookup, texture.addr, texture.size, {}});
+        }
+        // Replace a slice of the textures, as a streaming game would.
+        for (u32 i = frame * 64; i < frame * 64 + 64; i++) {
+            Operation& texture = textures[i];
+            trace.push_back({Type::Unregister, texture.addr, texture.size, texture.surface_id});
+            texture.surface_id = SurfaceId{next_id++};
+            trace.push_back(texture);
+        }
+    }
+    return trace;
+}
+
+/// The hashed page map the rasterizer cache used before SurfacePageTable, kept as a baseline.
+class HashedPageTable {
+public:
+    void Insert(PAddr addr, u32 size, SurfaceId surface_id) {
+        ForEachPage(addr, size, [&](u64 page) { page_table[page].push_back(surface_id); });
+    }
+
+    void Erase(PAddr addr, u32 size, SurfaceId surface_id) {
+        ForEachPage(addr, size, [&](u64 page) {
+            const auto it = page_table.find(page);
+            if (it == page_table.end()) {
+                return;
+            }
+            std::vector<SurfaceId>& surfaces = it.value();
+            surfaces.erase(std::find(surfaces.begin(), surfaces.end(), surface_id));
+        });
+    }
+
+    std::span<const SurfaceId> Surfaces(u64 page) const {
+        const auto it = page_table.find(page);
+        if (it == page_table.end()) {
+            return {};
+        }
+        return it->second;
+    }
+
+    void Clear() {
+        page_table.clear();
+    }
+
+private:
+    template <typename Func>
+    static void ForEachPage(PAddr addr, u32 size, Func&& func) {
+        const u64 page_end = (addr + size - 1) >> SurfacePageTable::PAGE_BITS;
+        for (u64 page = addr >> SurfacePageTable::PAGE_BITS; page <= page_end; page++) {
+            func(page);
+        }
+    }
+
+    tsl::robin_pg_map<u64, std::vector<SurfaceId>, Common::IdentityHash<u64>> page_table;
+};
+
+/**
+ * Replays the trace, returning the number of surfaces visited by lookups. Lookups walk the
+ * buckets of a region like FindMatch and InvalidateRegion do, without the surface checks
+ * those run on each visited surface.
+ */
+template <typename Table>
+std::size_t Replay(Table& table, const std::vector<Operation>& trace) {
+    std::size_t visited = 0;
+    for (const Operation& op : trace) {
+        switch (op.type) {
+        case Operation::Type::Register:
+            table.Insert(op.addr, op.size, op.surface_id);
+            break;
+        case Operation::Type::Unregister:
+            table.Erase(op.addr, op.size, op.surface_id);
+            break;
+        case Operation::Type::Lookup: {
+            const u64 page_end = (op.addr + op.size - 1) >> SurfacePageTable::PAGE_BITS;
+            for (u64 page = op.addr >> SurfacePageTable::PAGE_BITS; page <= page_end; page++) {
+                visited += table.Surfaces(page).size();
+            }
+            break;
+        }
+        }
+    }
+    return visited;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("SurfacePageTable: Surfaces are found in every page they touch", "[video_core]") {
+    SurfacePageTable table;
+    const SurfaceId surface_id{1};
+    const u64 first_page = VRAM_ADDR >> SurfacePageTable::PAGE_BITS;
+
+    table.Insert(VRAM_ADDR + TABLE_PAGE_SIZE - 4, 8, surface_id);
+    REQUIRE(!table.Empty());
+    REQUIRE(Contains(table.Surfaces(first_page), surface_id));
+    REQUIRE(Contains(table.Surfaces(first_page + 1), surface_id));
+    REQUIRE(table.Surfaces(first_page + 2).empty());
+    REQUIRE(table.Surfaces(first_page - 1).empty());
+
+    table.Erase(VRAM_ADDR + TABLE_PAGE_SIZE - 4, 8, surface_id);
+    REQUIRE(table.Empty());
+    REQUIRE(table.Surfaces(first_page).empty());
+    REQUIRE(table.Surfaces(first_page + 1).empty());
+}
+
+TEST_CASE("SurfacePageTable: Buckets keep registration order", "[video_core]") {
+    SurfacePageTable table;
+    const u64 page = FCRAM_ADDR >> SurfacePageTable::PAGE_BITS;
+    for (u32 i = 0; i < 4; i++) {
+        table.Insert(FCRAM_ADDR + i * 0x100, 0x100, SurfaceId{i});
+    }
+
+    table.Erase(FCRAM_ADDR + 0x100, 0x100, SurfaceId{1});
+    const std::vector<SurfaceId> expected{SurfaceId{0}, SurfaceId{2}, SurfaceId{3}};
+    const auto surfaces = table.Surfaces(page);
+    REQUIRE(std::equal(surfaces.begin(), surfaces.end(), expected.begin(), expected.end()));
+
+    table.Clear();
+    REQUIRE(table.Empty());
+    REQUIRE(table.Surfaces(page).empty());
+}
+
+TEST_CASE("SurfacePageTable: Ranges at the end of the address space", "[video_core]") {
+    SurfacePageTable table;
+    const SurfaceId surface_id{7};
+    table.Insert(0xFFFFFF00, 0x100, surface_id);
+    REQUIRE(Contains(table.Surfaces(SurfacePageTable::NUM_PAGES - 1), surface_id));
+    REQUIRE(table.Surfaces(SurfacePageTable::NUM_PAGES).empty());
+
+    table.Erase(0xFFFFFF00, 0x100, surface_id);
+    REQUIRE(table.Empty());
+}
+
+TEST_CASE("SurfacePageTable: Replaying a trace leaves the table empty", "[video_core]") {
+    SurfacePageTable table;
+    const std::vector<Operation> trace = MakeTrace();
+    REQUIRE(Replay(table, trace) > 0);
+
+    // Unregister the surfaces which are still alive.
+    std::vector<bool> alive;
+    for (const Operation& op : trace) {
+        if (op.type == Operation::Type::Lookup) {
+            continue;
+        }
+        alive.resize(std::max<std::size_t>(alive.size(), op.surface_id.index + 1));
+        alive[op.surface_id.index] = op.type == Operation::Type::Register;
+    }
+    for (const Operation& op : trace) {
+        if (op.type == Operation::Type::Register && alive[op.surface_id.index]) {
+            table.Erase(op.addr, op.size, op.surface_id);
+        }
+    }
+    REQUIRE(table.Empty());
+}
+
+TEST_CASE("SurfacePageTable: Lookups match the hashed page map", "[video_core]") {
+    const std::vector<Operation> trace = MakeTrace();
+    SurfacePageTable table;
+    HashedPageTable baseline;
+    REQUIRE(Replay(table, trace) == Replay(baseline, trace));
+}
+
+// Only the surface index is timed. FindMatch and InvalidateRegion need a full rasterizer cache,
+// whose runtime can't be created without a GPU.
+TEST_CASE("SurfacePageTable[Benchmark]", "[.][video_core][benchmark]") {
+    const std::vector<Operation> trace = MakeTrace();
+    SurfacePageTable table;
+    HashedPageTable baseline;
+
+    BENCHMARK("Replay surface index operations") {
+        table.Clear();
+        return Replay(table, trace);
+    };
+
+    BENCHMARK("Replay surface index operations (robin_pg_map baseline)") {
+        baseline.Clear();
+        return Replay(baseline, trace);
+    };
+}
@@ -0,0 +1,119 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <map>
+#include <catch2/catch_test_macros.hpp>
+#include "video_core/vertex_cache.h"
+
+using VideoCore::VertexCache;
+using Residency = VertexCache::Residency;
+
+namespace {
+
+struct PageCounter {
+    std::map<PAddr, int> counts;
+
+    VertexCache::PageCountCallback Callback() {
+        return [this](PAddr addr, u32, int delta) { counts[addr] += delta; };
+    }
+
+    int Total() const {
+        int total = 0;
+        for (const auto& [addr, count] : counts) {
+            total += count;
+        }
+        return total;
+    }
+};
+
+/// Looks the key up until it is asked to be uploaded and inserts it at the given offset.
+void MakeResident(VertexCache& cache, const VertexCache::Key& key, u32 offset) {
+    while (cache.Lookup(key).first != Residency::Upload) {
+    }
+    cache.Insert(key, offset);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("VertexCache: Ranges become resident after repeated use", "[video_core]") {
+    PageCounter counter;
+    VertexCache cache{counter.Callback()};
+    const VertexCache::Key key{0x18000000, 0x200, 16};
+
+    REQUIRE(cache.Lookup(key).first == Residency::Stream);
+    REQUIRE(cache.Lookup(key).first == Residency::Upload);
+    cache.Insert(key, 0x40);
+    REQUIRE(counter.Total() == 1);
+
+    const auto [residency, offset] = cache.Lookup(key);
+    REQUIRE(residency == Residency::Resident);
+    REQUIRE(offset == 0x40);
+
+    // The same range converted to another layout is a different entry.
+    REQUIRE(cache.Lookup({0x18000000, 0x200, 20}).first == Residency::Stream);
+}
+
+TEST_CASE("VertexCache: Oversized ranges are streamed", "[video_core]") {
+    PageCounter counter;
+    VertexCache cache{counter.Callback()};
+    const VertexCache::Key key{0x18000000, VertexCache::MaxEntrySize + 1, 4};
+
+    for (int i = 0; i < 4; i++) {
+        REQUIRE(cache.Lookup(key).first == Residency::Stream);
+    }
+    REQUIRE(cache.Lookup({0x18000000, 0, 4}).first == Residency::Stream);
+}
+
+TEST_CASE("VertexCache: Invalidation evicts overlapping ranges", "[video_core]") {
+    PageCounter counter;
+    VertexCache cache{counter.Callback()};
+    const VertexCache::Key first{0x18000000, 0x100, 8};
+    const VertexCache::Key second{0x18000100, 0x100, 8};
+    MakeResident(cache, first, 0);
+    MakeResident(cache, second, 0x100);
+    REQUIRE(counter.Total() == 2);
+
+    // Touching the last byte of the first range leaves the second one resident.
+    cache.InvalidateRegion(0x180000FF, 1);
+    REQUIRE(cache.Lookup(first).first != Residency::Resident);
+    REQUIRE(cache.Lookup(second).first == Residency::Resident);
+    REQUIRE(counter.Total() == 1);
+
+    // Writes outside of every range change nothing.
+    cache.InvalidateRegion(0x18001000, 0x1000);
+    REQUIRE(cache.Lookup(second).first == Residency::Resident);
+}
+
+TEST_CASE("VertexCache: Frequently written ranges are always streamed", "[video_core]") {
+    PageCounter counter;
+    VertexCache cache{counter.Callback()};
+    const VertexCache::Key key{0x18000000, 0x100, 8};
+
+    MakeResident(cache, key, 0);
+    cache.InvalidateRegion(key.addr, key.size);
+    MakeResident(cache, key, 0);
+    cache.InvalidateRegion(key.addr, key.size);
+
+    for (int i = 0; i < 4; i++) {
+        REQUIRE(cache.Lookup(key).first == Residency::Stream);
+    }
+    REQUIRE(counter.Total() == 0);
+}
+
+TEST_CASE("VertexCache: Clear releases every page", "[video_core]") {
+    PageCounter counter;
+    VertexCache cache{counter.Callback()};
+    const VertexCache::Key key{0x18000000, 0x3000, 8};
+
+    MakeResident(cache, key, 0);
+    REQUIRE(counter.Total() == 1);
+
+    cache.Clear();
+    REQUIRE(counter.Total() == 0);
+    REQUIRE(cache.Lookup(key).first == Residency::Stream);
+
+    // Invalidating after a clear must not release the pages a second time.
+    cache.InvalidateRegion(key.addr, key.size);
+    REQUIRE(counter.Total() == 0);
+}
@@ -0,0 +1,216 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <catch2/catch_test_macros.hpp>
+#include <nihstro/inline_assembly.h>
+#include "common/file_util.h"
+#include "common/hash.h"
+#include "video_core/pica/regs_internal.h"
+#include "video_core/pica/shader_setup.h"
+#include "video_core/renderer_vulkan/vk_shader_disk_cache.h"
+
+using Pica::Shader::FSConfig;
+using Pica::Shader::Profile;
+using Pica::Shader::Generator::PicaFixedGSConfig;
+using Pica::Shader::Generator::PicaVSConfig;
+using TevStageConfig = Pica::TexturingRegs::TevStageConfig;
+
+namespace Vulkan {
+
+/// Writes and inspects cache files the way the runtime does.
+struct ShaderDiskCacheTest {
+    using CacheFile = ShaderDiskCache::CacheFile;
+    using CacheFileType = ShaderDiskCache::CacheFileType;
+    using CacheEntryType = ShaderDiskCache::CacheEntryType;
+
+    static constexpr std::array OUTPUT_MASKS{0x1U, 0x3U, 0x7U, 0xFU};
+    static constexpr std::array TEV_OPERATIONS{
+        TevStageConfig::Operation::Replace,
+        TevStageConfig::Operation::Modulate,
+        TevStageConfig::Operation::Add,
+        TevStageConfig::Operation::Subtract,
+    };
+
+    struct EntryCounts {
+        std::size_t configs{};
+        std::size_t shaders{};
+        std::size_t programs{};
+        /// Configs stored before the shader they reference, or without it.
+        std::size_t unlinked_configs{};
+    };
+
+    static std::string GetCacheFile(const std::string& dir, u64 title_id, CacheFileType type) {
+        return ShaderDiskCache::GetCacheFile(dir, title_id, type, false);
+    }
+
+    /// Writes the configs a game would record, without any SPIRV.
+    static void WriteSourceCaches(const std::string& dir, u64 title_id, const Profile& profile) {
+        const auto shbin = nihstro::InlineAsm::CompileToRawBinary({
+            {nihstro::OpCode::Id::NOP},
+            {nihstro::OpCode::Id::END},
+        });
+        Pica::ProgramCode program_code{};
+        std::transform(shbin.program.begin(), shbin.program.end(), program_code.begin(),
+                       [](const auto& x) { return x.hex; });
+        Pica::ShaderSetup setup;
+        setup.UpdateProgramCode(program_code);
+
+        auto regs = std::make_unique<Pica::RegsInternal>();
+        regs->lighting.disable.Assign(1);
+
+        CacheFile vs_file(GetCacheFile(dir, title_id, CacheFileType::VS_CACHE));
+        CacheFile fs_file(GetCacheFile(dir, title_id, CacheFileType::FS_CACHE));
+        CacheFile gs_file(GetCacheFile(dir, title_id, CacheFileType::GS_CACHE));
+        for (auto [file, type] : {std::pair{&vs_file, CacheFileType::VS_CACHE},
+                                  std::pair{&fs_file, CacheFileType::FS_CACHE},
+                                  std::pair{&gs_file, CacheFileType::GS_CACHE}}) {
+            REQUIRE(file->SwitchMode(CacheFile::CacheOpMode::RECREATE));
+            ShaderDiskCache::AppendFileInfo(*file, type, profile);
+        }
+
+        bool program_written = false;
+        for (const u32 output_mask : OUTPUT_MASKS) {
+            regs->vs.output_mask.Assign(output_mask);
+
+            // Configs which only differ in the lighting state share their vertex shader.
+            for (const u32 lighting_disable : {0U, 1U}) {
+                regs->lighting.disable.Assign(lighting_disable);
+                const PicaVSConfig vs_config{*regs, setup};
+                const u64 program_id = Common::HashCombine(vs_config.state.program_hash,
+                                                           vs_config.state.swizzle_hash);
+                if (!program_written) {
+                    auto program = std::make_unique<ShaderDiskCache::VSProgramEntry>();
+                    program->version = ShaderDiskCache::VSProgramEntry::EXPECTED_VERSION;
+                    program->program_len = setup.GetBiggestProgramSize();
+                    program->program_code = setup.GetProgramCode();
+                    program->swizzle_len = setup.GetBiggestSwizzleSize();
+                    program->swizzle_code = setup.GetSwizzleData();
+                    ShaderDiskCache::AppendVSProgram(vs_file, *program, program_id);
+                    program_written = true;
+                }
+
+                ShaderDiskCache::VSConfigEntry vs_entry{};
+                vs_entry.version = ShaderDiskCache::VSConfigEntry::EXPECTED_VERSION;
+                vs_entry.program_entry_id = program_id;
+                vs_entry.vs_config = vs_config;
+                ShaderDiskCache::AppendVSConfig(vs_file, vs_entry, vs_config.Hash());
+            }
+
+            const PicaFixedGSConfig gs_config{*regs};
+            const ShaderDiskCache::GSConfigEntry gs_entry{
+                .version = ShaderDiskCache::GSConfigEntry::EXPECTED_VERSION,
+                .gs_config = gs_config,
+            };
+            ShaderDiskCache::AppendGSConfig(gs_file, gs_entry, gs_config.Hash());
+        }
+
+        for (const auto operation : TEV_OPERATIONS) {
+            regs->texturing.tev_stage0.color_op.Assign(operation);
+            regs->texturing.tev_stage0.color_source1.Assign(TevStageConfig::Source::Texture0);
+            const FSConfig fs_config{*regs};
+            const ShaderDiskCache::FSConfigEntry fs_entry{
+                .version = ShaderDiskCache::FSConfigEntry::EXPECTED_VERSION,
+                .fs_config = fs_config,
+            };
+            ShaderDiskCache::AppendFSConfig(fs_file, fs_entry, fs_config.Hash());
+        }
+    }
+
+    /// Reads back a cache file, checking every config follows the shader it uses.
+    static EntryCounts CountEntries(const std::string& dir, u64 title_id, CacheFileType type) {
+        CacheFile file(GetCacheFile(dir, title_id, type));
+        REQUIRE(ShaderDiskCache::ReadFileInfo(file, type).has_value());
+
+        EntryCounts counts;
+        std::unordered_set<u64> shaders;
+        const auto count_config = [&](u64 shader_id) {
+            counts.configs++;
+            if (!shaders.contains(shader_id)) {
+                counts.unlinked_configs++;
+            }
+        };
+
+        const std::size_t tot_entries = file.GetTotalEntries();
+        auto curr = file.ReadFirst();
+        for (std::size_t i = 1; i < tot_entries; i++) {
+            curr = file.ReadNext(curr);
+            REQUIRE(curr.Valid());
+
+            switch (curr.Type()) {
+            case CacheEntryType::VS_PROGRAM:
+                counts.programs++;
+                break;
+            case CacheEntryType::VS_SPIRV:
+            case CacheEntryType::FS_SPIRV:
+            case CacheEntryType::GS_SPIRV:
+                counts.shaders++;
+                shaders.insert(curr.Id());
+                break;
+            case CacheEntryType::VS_CONFIG: {
+                const auto* entry = curr.Payload<ShaderDiskCache::VSConfigEntry>();
+                REQUIRE(entry != nullptr);
+                count_config(entry->spirv_entry_id);
+                break;
+            }
+            case CacheEntryType::FS_CONFIG:
+            case CacheEntryType::GS_CONFIG:
+                count_config(curr.Id());
+                break;
+            default:
+                FAIL("Unexpected entry type");
+            }
+        }
+        return counts;
+    }
+};
+
+} // namespace Vulkan
+
+using Vulkan::ShaderDiskCacheTest;
+
+TEST_CASE("ShaderDiskCache: Offline builds write every config after its shader", "[video_core]") {
+    using CacheFileType = ShaderDiskCacheTest::CacheFileType;
+    constexpr u64 title_id = 0x0004000000123400;
+
+    const std::string dir =
+        (std::filesystem::temp_directory_path() / "citra_shader_disk_cache_test").string();
+    FileUtil::DeleteDirRecursively(dir);
+    REQUIRE(FileUtil::CreateFullPath(dir + DIR_SEP));
+
+    Profile profile{};
+    profile.has_separable_shaders = true;
+    profile.has_clip_planes = true;
+    profile.has_geometry_shader = true;
+    profile.vk_disable_spirv_optimizer = true;
+    profile.is_vulkan = true;
+    ShaderDiskCacheTest::WriteSourceCaches(dir, title_id, profile);
+
+    // Rebuild in place with several workers, so that configs sharing a shader race each other.
+    REQUIRE(Vulkan::ShaderDiskCache::BuildTransferableCache(title_id, dir, dir, 4));
+
+    const auto vs = ShaderDiskCacheTest::CountEntries(dir, title_id, CacheFileType::VS_CACHE);
+    REQUIRE(vs.configs == ShaderDiskCacheTest::OUTPUT_MASKS.size() * 2);
+    REQUIRE(vs.programs == 1);
+    REQUIRE(vs.shaders > 0);
+    REQUIRE(vs.shaders <= vs.configs);
+    REQUIRE(vs.unlinked_configs == 0);
+
+    const auto fs = ShaderDiskCacheTest::CountEntries(dir, title_id, CacheFileType::FS_CACHE);
+    REQUIRE(fs.configs == ShaderDiskCacheTest::TEV_OPERATIONS.size());
+    REQUIRE(fs.shaders == fs.configs);
+    REQUIRE(fs.unlinked_configs == 0);
+
+    const auto gs = ShaderDiskCacheTest::CountEntries(dir, title_id, CacheFileType::GS_CACHE);
+    REQUIRE(gs.configs == ShaderDiskCacheTest::OUTPUT_MASKS.size());
+    REQUIRE(gs.shaders == gs.configs);
+    REQUIRE(gs.unlinked_configs == 0);
+
+    FileUtil::DeleteDirRecursively(dir);
+}
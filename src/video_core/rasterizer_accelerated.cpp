@@ -195,6 +195,31 @@ void RasterizerAccelerated::SyncDrawUniforms() {
         fs_data_dirty = true;
     }
 
+    // Sync the TEV configuration read by uber fragment shaders. Stage configs are not covered
+    // by the dirty table, so compare them manually
+    const auto tev_stages = regs.texturing.GetTevStages();
+    for (std::size_t index = 0; index < tev_stages.size(); ++index) {
+        const auto& stage = tev_stages[index];
+        const Common::Vec4u stage_config{stage.sources_raw, stage.modifiers_raw, stage.ops_raw,
+                                         stage.scales_raw};
+        if (fs_data.tev_stage_config[index] != stage_config) {
+            fs_data.tev_stage_config[index] = stage_config;
+            fs_data_dirty = true;
+        }
+    }
+
+    const auto& buffer_input = regs.texturing.tev_combiner_buffer_input;
+    const auto& alpha_test = regs.framebuffer.output_merger.alpha_test;
+    const Common::Vec4u tev_config{
+        buffer_input.update_mask_rgb.Value() | buffer_input.update_mask_a.Value() << 4,
+        static_cast<u32>(alpha_test.enable ? alpha_test.func.Value()
+                                           : Pica::FramebufferRegs::CompareFunc::Always),
+        0, 0};
+    if (fs_data.tev_config != tev_config) {
+        fs_data.tev_config = tev_config;
+        fs_data_dirty = true;
+    }
+
     // Sync global lighting uniforms
     if (dirty.CheckLightingAmbient()) {
         fs_data.lighting_global_ambient = LightColor(regs.lighting.global_ambient);
@@ -32,6 +32,13 @@ constexpr auto RangeFromInterval(const auto& map, const auto& interval) {
     return boost::make_iterator_range(map.equal_range(interval));
 }
 
+/// Number of consecutive frames a surface has to be read back before it is downloaded ahead
+/// of time, when it stops being rendered to.
+constexpr u32 ReadbackStreakThreshold = 3;
+
+/// Upper bound of readbacks waiting for the guest to read them.
+constexpr std::size_t MaxPendingReadbacks = 8;
+
 template <class T>
 RasterizerCache<T>::RasterizerCache(Memory::MemorySystem& memory_,
                                     CustomTexManager& custom_tex_manager_, Runtime& runtime_,
@@ -105,6 +112,11 @@ void RasterizerCache<T>::TickFrame() {
     custom_tex_manager.TickFrame();
     RunGarbageCollector();
 
+    frame_count++;
+    std::erase_if(pending_readbacks, [this](const PendingReadback& readback) {
+        return slot_surfaces[readback.surface_id].ModificationTick() != readback.modification_tick;
+    });
+
     const auto new_filter = Settings::values.texture_filter.GetValue();
     if (filter != new_filter) [[unlikely]] {
         filter = new_filter;
@@ -784,6 +796,20 @@ FramebufferHelper<T> RasterizerCache<T>::GetFramebufferSurfaces(bool using_color
                         boost::icl::length(depth_vp_interval));
     }
 
+    // Surfaces which stopped being rendered to are likely to be read back next.
+    if (color_id != bound_color_id) {
+        if (bound_color_id) {
+            QueueReadback(bound_color_id);
+        }
+        bound_color_id = color_id;
+    }
+    if (depth_id != bound_depth_id) {
+        if (bound_depth_id) {
+            QueueReadback(bound_depth_id);
+        }
+        bound_depth_id = depth_id;
+    }
+
     const FramebufferParams fb_params = {
         .color_id = color_id,
         .depth_id = depth_id,
@@ -837,15 +863,7 @@ void RasterizerCache<T>::ForEachSurfaceInRegion(PAddr addr, std::size_t size, Fu
     static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
     boost::container::small_vector<SurfaceId, 8> surfaces;
     ForEachPage(addr, size, [this, &surfaces, addr, size, func](u64 page) {
-        const auto it = page_table.find(page);
-        if (it == page_table.end()) {
-            if constexpr (BOOL_BREAK) {
-                return false;
-            } else {
-                return;
-            }
-        }
-        for (const SurfaceId surface_id : it->second) {
+        for (const SurfaceId surface_id : page_table.Surfaces(page)) {
             Surface& surface = slot_surfaces[surface_id];
             if (True(surface.flags & SurfaceFlagBits::Picked)) {
                 continue;
@@ -886,10 +904,17 @@ SurfaceId RasterizerCache<T>::FindMatch(const SurfaceParams& params, ScaleMatch
         const bool res_scale_matched = match_scale_type == ScaleMatch::Exact
                                            ? (params.res_scale == surface.res_scale)
                                            : (params.res_scale <= surface.res_scale);
-        const bool is_valid =
-            True(find_flags & MatchFlags::Copy)
-                ? true
-                : surface.IsRegionValid(validate_interval.value_or(params.GetInterval()));
+        // Validity is only needed to rank matches, so it isn't computed for the surfaces which
+        // merely overlap the region.
+        std::optional<bool> is_valid_cache;
+        const auto IsValid = [&] {
+            if (!is_valid_cache) {
+                is_valid_cache = True(find_flags & MatchFlags::Copy) ||
+                                 surface.IsRegionValid(
+                                     validate_interval.value_or(params.GetInterval()));
+            }
+            return *is_valid_cache;
+        };
 
         auto IsMatch_Helper = [&](auto check_type, auto match_fn) {
             if (False(find_flags & check_type))
@@ -906,6 +931,7 @@ SurfaceId RasterizerCache<T>::FindMatch(const SurfaceParams& params, ScaleMatch
                 return;
 
             // Found a match, update only if this is better than the previous one
+            const bool is_valid = IsValid();
             auto UpdateMatch = [&] {
                 match_id = surface_id;
                 match_valid = is_valid;
@@ -1042,17 +1068,20 @@ void RasterizerCache<T>::UploadSurface(Surface& surface, SurfaceInterval interva
     const SurfaceParams load_info = surface.FromInterval(interval);
     ASSERT(load_info.addr >= surface.addr && load_info.end <= surface.end);
 
-    const auto staging = runtime.FindStaging(
-        load_info.width * load_info.height * surface.GetInternalBytesPerPixel(), true);
-
     MemoryRef source_ptr = memory.GetPhysicalRef(load_info.addr);
     if (!source_ptr) [[unlikely]] {
         return;
     }
 
+    // Prefer letting the backend decode tiled textures, so only a copy is made here.
     const auto upload_data = source_ptr.GetWriteBytes(load_info.end - load_info.addr);
-    DecodeTexture(load_info, load_info.addr, load_info.end, upload_data, staging.mapped,
-                  runtime.NeedsConversion(surface));
+    auto staging = runtime.DecodeTiled(load_info, upload_data);
+    if (!staging) {
+        staging = runtime.FindStaging(
+            load_info.width * load_info.height * surface.GetInternalBytesPerPixel(), true);
+        DecodeTexture(load_info, load_info.addr, load_info.end, upload_data, staging->mapped,
+                      runtime.NeedsConversion(surface));
+    }
 
     const bool should_dump = False(surface.flags & SurfaceFlagBits::Custom) &&
                              False(surface.flags & SurfaceFlagBits::RenderTarget);
@@ -1063,12 +1092,12 @@ void RasterizerCache<T>::UploadSurface(Surface& surface, SurfaceInterval interva
     }
 
     const BufferTextureCopy upload = {
-        .buffer_offset = staging.offset,
-        .buffer_size = staging.size,
+        .buffer_offset = staging->offset,
+        .buffer_size = staging->size,
         .texture_rect = surface.GetSubRect(load_info),
         .texture_level = surface.LevelOf(load_info.addr),
     };
-    surface.Upload(upload, staging);
+    surface.Upload(upload, *staging);
 }
 
 template <class T>
@@ -1196,6 +1225,102 @@ void RasterizerCache<T>::DownloadFillSurface(Surface& surface, SurfaceInterval i
     }
 }
 
+template <class T>
+void RasterizerCache<T>::TrackReadback(Surface& surface) {
+    if (surface.readback_frame == frame_count) {
+        return;
+    }
+    const bool consecutive = surface.readback_frame + 1 == frame_count;
+    surface.readback_streak = consecutive ? surface.readback_streak + 1 : 1;
+    surface.readback_frame = frame_count;
+}
+
+template <class T>
+void RasterizerCache<T>::QueueReadback(SurfaceId surface_id) {
+    Surface& surface = slot_surfaces[surface_id];
+    if (!runtime.SupportsAsyncDownload() || !surface.is_tiled ||
+        surface.readback_streak < ReadbackStreakThreshold ||
+        surface.readback_frame + 1 < frame_count) {
+        return;
+    }
+
+    std::erase_if(pending_readbacks, [surface_id](const PendingReadback& readback) {
+        return readback.surface_id == surface_id;
+    });
+
+    SurfaceRegions owned_regions;
+    for (const auto& [region, owner_id] : RangeFromInterval(dirty_regions, surface.GetInterval())) {
+        if (owner_id == surface_id) {
+            owned_regions += region;
+        }
+    }
+    if (boost::icl::is_empty(owned_regions)) {
+        return;
+    }
+
+    // Download a single rectangle per level, covering all the regions the guest may read.
+    const SurfaceInterval owned_hull = boost::icl::hull(owned_regions);
+    for (u32 level = 0; level < surface.levels; level++) {
+        const auto interval = owned_hull & surface.LevelInterval(level);
+        if (boost::icl::is_empty(interval)) {
+            continue;
+        }
+
+        const SurfaceParams flush_info = surface.FromInterval(interval);
+        const auto staging = runtime.FindStaging(
+            flush_info.width * flush_info.height * surface.GetInternalBytesPerPixel(), false);
+        const BufferTextureCopy download = {
+            .buffer_offset = staging.offset,
+            .buffer_size = staging.size,
+            .texture_rect = surface.GetSubRect(flush_info),
+            .texture_level = level,
+        };
+
+        if (pending_readbacks.size() == MaxPendingReadbacks) {
+            pending_readbacks.erase(pending_readbacks.begin());
+        }
+        pending_readbacks.push_back({
+            .surface_id = surface_id,
+            .interval = interval,
+            .staging = staging,
+            .fence = surface.DownloadAsync(download, staging),
+            .modification_tick = surface.ModificationTick(),
+        });
+    }
+}
+
+template <class T>
+bool RasterizerCache<T>::DownloadFromReadback(SurfaceId surface_id, SurfaceInterval interval) {
+    Surface& surface = slot_surfaces[surface_id];
+    const auto it = std::ranges::find_if(pending_readbacks, [&](const PendingReadback& readback) {
+        return readback.surface_id == surface_id &&
+               readback.modification_tick == surface.ModificationTick() &&
+               boost::icl::contains(readback.interval, interval);
+    });
+    if (it == pending_readbacks.end()) {
+        return false;
+    }
+    if (!runtime.FinishDownload(it->fence, it->staging)) {
+        pending_readbacks.erase(it);
+        return false;
+    }
+
+    MICROPROFILE_SCOPE(RasterizerCache_DownloadSurface);
+
+    const u32 flush_start = boost::icl::first(interval);
+    const u32 flush_end = boost::icl::last_next(interval);
+    MemoryRef dest_ptr = memory.GetPhysicalRef(flush_start);
+    if (!dest_ptr) [[unlikely]] {
+        return true;
+    }
+
+    const SurfaceParams flush_info = surface.FromInterval(it->interval);
+    const auto download_dest = dest_ptr.GetWriteBytes(flush_end - flush_start);
+    EncodeTexture(flush_info, flush_start, flush_end, it->staging.mapped, download_dest,
+                  runtime.NeedsConversion(surface));
+    return true;
+}
+
 template <class T>
 bool RasterizerCache<T>::ValidateByReinterpretation(Surface& surface, SurfaceParams params,
                                                     const SurfaceInterval& interval) {
@@ -1259,7 +1384,7 @@ void RasterizerCache<T>::ClearAll(bool flush) {
     // Remove the whole cache without really looking at it.
     cached_pages -= flush_interval;
     dirty_regions.clear();
-    page_table.clear();
+    page_table.Clear();
 }
 
 template <class T>
@@ -1293,6 +1418,8 @@ void RasterizerCache<T>::FlushRegion(PAddr addr, u32 size, SurfaceId flush_surfa
             continue;
         }
 
+        TrackReadback(surface);
+
         // Download each requested level of the surface.
         const u32 start_level = surface.LevelOf(interval.lower());
         const u32 end_level = surface.LevelOf(interval.upper());
@@ -1301,12 +1428,15 @@ void RasterizerCache<T>::FlushRegion(PAddr addr, u32 size, SurfaceId flush_surfa
             if (boost::icl::is_empty(download_interval)) {
                 continue;
             }
-            DownloadSurface(surface, download_interval);
+            if (!DownloadFromReadback(surface_id, download_interval)) {
+                DownloadSurface(surface, download_interval);
+            }
         }
     }
 
     // Reset dirty regions
     dirty_regions -= flushed_intervals;
+    downloaded_regions += flushed_intervals;
 }
 
 template <class T>
@@ -1391,8 +1521,7 @@ void RasterizerCache<T>::RegisterSurface(SurfaceId surface_id) {
 
     surface.flags |= SurfaceFlagBits::Registered;
     UpdatePagesCachedCount(surface.addr, surface.size, 1);
-    ForEachPage(surface.addr, surface.size,
-                [this, surface_id](u64 page) { page_table[page].push_back(surface_id); });
+    page_table.Insert(surface.addr, surface.size, surface_id);
 }
 
 template <class T>
@@ -1403,21 +1532,17 @@ void RasterizerCache<T>::UnregisterSurface(SurfaceId surface_id) {
 
     surface.flags &= ~SurfaceFlagBits::Registered;
     UpdatePagesCachedCount(surface.addr, surface.size, -1);
-    ForEachPage(surface.addr, surface.size, [this, surface_id](u64 page) {
-        const auto page_it = page_table.find(page);
-        if (page_it == page_table.end()) {
-            ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << CITRA_PAGEBITS);
-            return;
-        }
-        std::vector<SurfaceId>& surfaces = page_it.value();
-        const auto vector_it = std::find(surfaces.begin(), surfaces.end(), surface_id);
-        if (vector_it == surfaces.end()) {
-            ASSERT_MSG(false, "Unregistering unregistered surface in page=0x{:x}",
-                       page << CITRA_PAGEBITS);
-            return;
-        }
-        surfaces.erase(vector_it);
+
+    std::erase_if(pending_readbacks, [surface_id](const PendingReadback& readback) {
+        return readback.surface_id == surface_id;
     });
+    if (bound_color_id == surface_id) {
+        bound_color_id = {};
+    }
+    if (bound_depth_id == surface_id) {
+        bound_depth_id = {};
+    }
+    page_table.Erase(surface.addr, surface.size, surface_id);
 
     if (surface.type != SurfaceType::Fill) {
         RemoveTextureCubeFace(surface_id);
@@ -1431,9 +1556,9 @@ void RasterizerCache<T>::UnregisterSurface(SurfaceId surface_id) {
 template <class T>
 void RasterizerCache<T>::UnregisterAll() {
     FlushAll();
-    for (auto& [page, surfaces] : page_table) {
-        while (!surfaces.empty()) {
-            UnregisterSurface(surfaces.back());
+    for (u64 page = 0; page < SurfacePageTable::NUM_PAGES && !page_table.Empty(); page++) {
+        while (!page_table.Surfaces(page).empty()) {
+            UnregisterSurface(page_table.Surfaces(page).back());
         }
     }
     runtime.Finish();
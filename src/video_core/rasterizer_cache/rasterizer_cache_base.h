@@ -9,12 +9,14 @@
 #include <optional>
 #include <span>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <boost/icl/interval_map.hpp>
-#include <tsl/robin_map.h>
 
 #include "video_core/rasterizer_cache/framebuffer_base.h"
 #include "video_core/rasterizer_cache/sampler_params.h"
+#include "video_core/rasterizer_cache/surface_base.h"
+#include "video_core/rasterizer_cache/surface_page_table.h"
 #include "video_core/rasterizer_cache/surface_params.h"
 #include "video_core/rasterizer_cache/texture_cube.h"
 
@@ -61,7 +63,7 @@ enum class SurfaceFlagBits : u32;
 template <class T>
 class RasterizerCache {
     /// Address shift for caching surfaces into a hash table
-    static constexpr u64 CITRA_PAGEBITS = 18;
+    static constexpr u64 CITRA_PAGEBITS = SurfacePageTable::PAGE_BITS;
 
     using Runtime = typename T::Runtime;
     using Sampler = typename T::Sampler;
@@ -138,11 +140,19 @@ public:
     /// Clear all cached resources tracked by this cache manager
     void ClearAll(bool flush);
 
+    /// Increase/decrease the number of cached objects in pages touching the specified region
+    void UpdatePagesCachedCount(PAddr addr, u32 size, int delta);
+
+    /// Returns the guest memory written by surface downloads since the last call
+    SurfaceRegions TakeDownloadedRegions() {
+        return std::exchange(downloaded_regions, {});
+    }
+
 private:
     /// Iterate over all page indices in a range
     template <typename Func>
     void ForEachPage(PAddr addr, std::size_t size, Func&& func) {
-        static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result<Func, u64>, bool>;
+        static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result_t<Func, u64>, bool>;
         const u64 page_end = (addr + size - 1) >> CITRA_PAGEBITS;
         for (u64 page = addr >> CITRA_PAGEBITS; page <= page_end; ++page) {
             if constexpr (RETURNS_BOOL) {
@@ -191,6 +201,15 @@ private:
     /// Downloads a fill surface to guest VRAM
     void DownloadFillSurface(Surface& surface, SurfaceInterval interval);
 
+    /// Updates the readback history of a surface the guest is reading back
+    void TrackReadback(Surface& surface);
+
+    /// Starts downloading the dirty regions of a surface which is read back every frame
+    void QueueReadback(SurfaceId surface_id);
+
+    /// Writes interval back to guest VRAM from a queued readback, if one is still valid
+    bool DownloadFromReadback(SurfaceId surface_id, SurfaceInterval interval);
+
     /// Attempt to find a reinterpretable surface in the cache and use it to copy for validation
     bool ValidateByReinterpretation(Surface& surface, SurfaceParams params,
                                     const SurfaceInterval& interval);
@@ -207,17 +226,23 @@ private:
     /// Unregisters all surfaces from the cache
     void UnregisterAll();
 
-    /// Increase/decrease the number of surface in pages touching the specified region
-    void UpdatePagesCachedCount(PAddr addr, u32 size, int delta);
-
 private:
+    /// Download started ahead of the guest reading the surface back
+    struct PendingReadback {
+        SurfaceId surface_id;
+        SurfaceInterval interval;
+        StagingData staging;
+        u64 fence;
+        u64 modification_tick;
+    };
+
     Memory::MemorySystem& memory;
     CustomTexManager& custom_tex_manager;
     Runtime& runtime;
     Pica::RegsInternal& regs;
     RendererBase& renderer;
     std::unordered_map<TextureCubeConfig, TextureCube> texture_cube_cache;
-    tsl::robin_pg_map<u64, std::vector<SurfaceId>, Common::IdentityHash<u64>> page_table;
+    SurfacePageTable page_table;
     std::unordered_map<FramebufferParams, FramebufferId> framebuffers;
     std::unordered_map<SamplerParams, SamplerId> samplers;
     std::list<std::pair<SurfaceId, u64>> sentenced;
@@ -225,6 +250,11 @@ private:
     Common::SlotVector<Sampler> slot_samplers;
     Common::SlotVector<Framebuffer> slot_framebuffers;
     SurfaceMap dirty_regions;
+    SurfaceRegions downloaded_regions;
+    std::vector<PendingReadback> pending_readbacks;
+    SurfaceId bound_color_id;
+    SurfaceId bound_depth_id;
+    u64 frame_count = 1;
     PageMap cached_pages;
     u32 resolution_scale_factor;
     FramebufferParams fb_params;
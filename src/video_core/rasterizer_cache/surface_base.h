@@ -90,6 +90,8 @@ public:
     u32 fill_size = 0;
     std::array<u8, 4> fill_data{};
     u64 modification_tick = 1;
+    u64 readback_frame = 0;  ///< Last frame the guest read the surface back.
+    u32 readback_streak = 0; ///< Number of consecutive frames the surface was read back.
 };
 
 } // namespace VideoCore
@@ -0,0 +1,62 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include "common/assert.h"
+#include "video_core/rasterizer_cache/surface_page_table.h"
+
+namespace VideoCore {
+
+namespace {
+
+template <typename Func>
+void ForEachPage(PAddr addr, u32 size, Func&& func) {
+    const u64 page_end =
+        std::min<u64>((u64{addr} + size - 1) >> SurfacePageTable::PAGE_BITS,
+                      SurfacePageTable::NUM_PAGES - 1);
+    for (u64 page = addr >> SurfacePageTable::PAGE_BITS; page <= page_end; ++page) {
+        func(page);
+    }
+}
+
+} // Anonymous namespace
+
+SurfacePageTable::SurfacePageTable() : buckets(NUM_PAGES) {}
+
+SurfacePageTable::~SurfacePageTable() = default;
+
+void SurfacePageTable::Insert(PAddr addr, u32 size, SurfaceId surface_id) {
+    ASSERT(size > 0);
+    ForEachPage(addr, size, [&](u64 page) {
+        buckets[page].push_back(surface_id);
+        num_entries++;
+    });
+}
+
+void SurfacePageTable::Erase(PAddr addr, u32 size, SurfaceId surface_id) {
+    ASSERT(size > 0);
+    ForEachPage(addr, size, [&](u64 page) {
+        std::vector<SurfaceId>& surfaces = buckets[page];
+        const auto it = std::find(surfaces.begin(), surfaces.end(), surface_id);
+        if (it == surfaces.end()) {
+            ASSERT_MSG(false, "Unregistering unregistered surface in page=0x{:x}",
+                       page << PAGE_BITS);
+            return;
+        }
+        surfaces.erase(it);
+        num_entries--;
+    });
+}
+
+void SurfacePageTable::Clear() {
+    if (num_entries == 0) {
+        return;
+    }
+    for (std::vector<SurfaceId>& surfaces : buckets) {
+        surfaces.clear();
+    }
+    num_entries = 0;
+}
+
+} // namespace VideoCore
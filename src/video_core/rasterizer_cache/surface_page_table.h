@@ -0,0 +1,54 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include "common/common_types.h"
+#include "video_core/rasterizer_cache/slot_id.h"
+
+namespace VideoCore {
+
+/**
+ * Spatial index of the registered surfaces, bucketed by page of the physical address space.
+ * The buckets live in a flat array indexed by page number, so looking up the surfaces of a
+ * region never hashes and only touches the buckets the region spans.
+ */
+class SurfacePageTable {
+public:
+    static constexpr u32 PAGE_BITS = 18;
+    static constexpr u64 NUM_PAGES = 1ULL << (32 - PAGE_BITS);
+
+    SurfacePageTable();
+    ~SurfacePageTable();
+
+    /// Adds the surface to the bucket of every page the range touches.
+    void Insert(PAddr addr, u32 size, SurfaceId surface_id);
+
+    /// Removes the surface from the bucket of every page the range touches.
+    void Erase(PAddr addr, u32 size, SurfaceId surface_id);
+
+    /// Returns the surfaces touching a page, in registration order.
+    [[nodiscard]] std::span<const SurfaceId> Surfaces(u64 page) const {
+        if (page >= NUM_PAGES) {
+            return {};
+        }
+        return buckets[page];
+    }
+
+    /// Returns true when no surface is registered.
+    [[nodiscard]] bool Empty() const noexcept {
+        return num_entries == 0;
+    }
+
+    /// Removes every surface.
+    void Clear();
+
+private:
+    std::vector<std::vector<SurfaceId>> buckets;
+    std::size_t num_entries = 0;
+};
+
+} // namespace VideoCore
@@ -19,8 +19,9 @@ RendererBase::~RendererBase() = default;
 
 u32 RendererBase::GetResolutionScaleFactor() {
     const auto graphics_api = Settings::GetWorkingGraphicsAPI();
-    if (graphics_api == Settings::GraphicsAPI::Software) {
-        // Software renderer always render at native resolution
+    if (graphics_api == Settings::GraphicsAPI::Software ||
+        graphics_api == Settings::GraphicsAPI::Null) {
+        // Software and null renderers always render at native resolution
         return 1;
     }
 
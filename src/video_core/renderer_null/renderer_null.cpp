@@ -0,0 +1,18 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "video_core/renderer_null/renderer_null.h"
+
+namespace NullRenderer {
+
+RendererNull::RendererNull(Core::System& system, Frontend::EmuWindow& window)
+    : VideoCore::RendererBase{system, window, nullptr} {}
+
+RendererNull::~RendererNull() = default;
+
+void RendererNull::SwapBuffers() {
+    EndFrame();
+}
+
+} // namespace NullRenderer
@@ -0,0 +1,54 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "video_core/rasterizer_interface.h"
+#include "video_core/renderer_base.h"
+
+namespace Core {
+class System;
+}
+
+namespace NullRenderer {
+
+/**
+ * Rasterizer which accepts every draw without executing it. Display transfers and fills are left
+ * to the software blitter, which performs them directly on emulated memory.
+ */
+class RasterizerNull : public VideoCore::RasterizerInterface {
+public:
+    void AddTriangle(const Pica::OutputVertex& v0, const Pica::OutputVertex& v1,
+                     const Pica::OutputVertex& v2) override {}
+    void DrawTriangles() override {}
+    void FlushAll() override {}
+    void FlushRegion(PAddr addr, u32 size) override {}
+    void InvalidateRegion(PAddr addr, u32 size) override {}
+    void FlushAndInvalidateRegion(PAddr addr, u32 size) override {}
+    void ClearAll(bool flush) override {}
+
+    /// Claims the draw so the vertex shaders are not run on the CPU either.
+    bool AccelerateDrawBatch(bool is_indexed) override {
+        return true;
+    }
+};
+
+/// Renderer which never rasterizes or presents, used to measure CPU and HLE throughput.
+class RendererNull : public VideoCore::RendererBase {
+public:
+    explicit RendererNull(Core::System& system, Frontend::EmuWindow& window);
+    ~RendererNull() override;
+
+    [[nodiscard]] VideoCore::RasterizerInterface* Rasterizer() override {
+        return &rasterizer;
+    }
+
+    void SwapBuffers() override;
+    void TryPresent(int timeout_ms, bool is_secondary) override {}
+
+private:
+    RasterizerNull rasterizer;
+};
+
+} // namespace NullRenderer
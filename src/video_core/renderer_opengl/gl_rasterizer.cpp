@@ -34,6 +34,8 @@ constexpr std::size_t VERTEX_BUFFER_SIZE = 16_MiB;
 constexpr std::size_t INDEX_BUFFER_SIZE = 2_MiB;
 constexpr std::size_t UNIFORM_BUFFER_SIZE = 8_MiB;
 constexpr std::size_t TEXTURE_BUFFER_SIZE = 2_MiB;
+constexpr std::size_t VERTEX_CACHE_BUFFER_SIZE = 32_MiB;
+constexpr std::size_t INDEX_CACHE_BUFFER_SIZE = 8_MiB;
 
 GLenum MakePrimitiveMode(Pica::PipelineRegs::TriangleTopology topology) {
     switch (topology) {
@@ -91,7 +93,15 @@ RasterizerOpenGL::RasterizerOpenGL(Memory::MemorySystem& memory, Pica::PicaCore&
       uniform_buffer{driver, GL_UNIFORM_BUFFER, UNIFORM_BUFFER_SIZE},
       index_buffer{driver, GL_ELEMENT_ARRAY_BUFFER, INDEX_BUFFER_SIZE},
       texture_buffer{driver, GL_TEXTURE_BUFFER, TextureBufferSize(driver, false)},
-      texture_lf_buffer{driver, GL_TEXTURE_BUFFER, TextureBufferSize(driver, true)} {
+      texture_lf_buffer{driver, GL_TEXTURE_BUFFER, TextureBufferSize(driver, true)},
+      vertex_cache_buffer{driver, GL_ARRAY_BUFFER, VERTEX_CACHE_BUFFER_SIZE},
+      index_cache_buffer{driver, GL_ELEMENT_ARRAY_BUFFER, INDEX_CACHE_BUFFER_SIZE},
+      vertex_cache{[this](PAddr addr, u32 size, int delta) {
+          res_cache.UpdatePagesCachedCount(addr, size, delta);
+      }},
+      index_cache{[this](PAddr addr, u32 size, int delta) {
+          res_cache.UpdatePagesCachedCount(addr, size, delta);
+      }} {
 
     // Clipping plane 0 is always enabled for PICA fixed clip plane z <= 0
     state.clip_distance[0] = true;
@@ -369,18 +379,97 @@ void RasterizerOpenGL::SetupVertexArray(u8* array_ptr, GLintptr buffer_offset,
     MICROPROFILE_SCOPE(OpenGL_VAO);
     const auto& vertex_attributes = regs.pipeline.vertex_attributes;
     PAddr base_address = vertex_attributes.GetPhysicalBaseAddress();
+    const u32 vertex_num = vs_input_index_max - vs_input_index_min + 1;
 
     state.draw.vertex_array = hw_vao.handle;
-    state.draw.vertex_buffer = vertex_buffer.GetHandle();
     state.Apply();
 
+    // Find the loaders whose data is already resident in the vertex cache
+    struct LoaderData {
+        VideoCore::VertexCache::Key key;
+        VideoCore::VertexCache::Residency residency;
+        u32 offset;
+    };
+    std::array<LoaderData, 12> loader_data;
+    u32 loader_count = 0;
+    for (const auto& loader : vertex_attributes.attribute_loaders) {
+        if (loader.component_count == 0 || loader.byte_count == 0) {
+            continue;
+        }
+
+        const PAddr data_addr =
+            base_address + loader.data_offset + (vs_input_index_min * loader.byte_count);
+        const u32 data_size = loader.byte_count * vertex_num;
+        res_cache.FlushRegion(data_addr, data_size);
+        loader_data[loader_count++].key = {data_addr, data_size, loader.byte_count};
+    }
+
+    // The flushes above may have written guest memory backing cached copies.
+    InvalidateDownloadedVertexData();
+
+    GLsizeiptr cache_size = 0;
+    for (u32 i = 0; i < loader_count; i++) {
+        LoaderData& data = loader_data[i];
+        std::tie(data.residency, data.offset) = vertex_cache.Lookup(data.key);
+        if (data.residency != VideoCore::VertexCache::Residency::Upload) {
+            continue;
+        }
+        const auto is_same_upload = [&data](const LoaderData& other) {
+            return other.residency == VideoCore::VertexCache::Residency::Upload &&
+                   other.key == data.key;
+        };
+        if (std::any_of(loader_data.begin(), loader_data.begin() + i, is_same_upload)) {
+            // Another loader reads the same data, only copy it once to the cache.
+            data.residency = VideoCore::VertexCache::Residency::Stream;
+            continue;
+        }
+        cache_size += Common::AlignUp(data.key.size, 4);
+    }
+
+    // Copy the new cache entries. Wrapping around orphans the buffer, which drops every copy.
+    if (cache_size > 0) {
+        state.draw.vertex_buffer = vertex_cache_buffer.GetHandle();
+        state.Apply();
+
+        const auto [cache_ptr, cache_offset, invalidate] = vertex_cache_buffer.Map(cache_size, 4);
+        if (invalidate) {
+            vertex_cache.Clear();
+        }
+
+        GLintptr offset = 0;
+        for (u32 i = 0; i < loader_count; i++) {
+            LoaderData& data = loader_data[i];
+            if (invalidate && data.residency == VideoCore::VertexCache::Residency::Resident) {
+                data.residency = VideoCore::VertexCache::Residency::Stream;
+            }
+            if (data.residency != VideoCore::VertexCache::Residency::Upload) {
+                continue;
+            }
+            std::memcpy(cache_ptr + offset, memory.GetPhysicalPointer(data.key.addr),
+                        data.key.size);
+            data.offset = static_cast<u32>(cache_offset + offset);
+            data.residency = VideoCore::VertexCache::Residency::Resident;
+            vertex_cache.Insert(data.key, data.offset);
+            offset += Common::AlignUp(data.key.size, 4);
+        }
+        vertex_cache_buffer.Unmap(cache_size);
+    }
+
     std::array<bool, 16> enable_attributes{};
 
+    u32 loader_index = 0;
     for (const auto& loader : vertex_attributes.attribute_loaders) {
         if (loader.component_count == 0 || loader.byte_count == 0) {
             continue;
         }
 
+        const LoaderData& data = loader_data[loader_index++];
+        const bool resident = data.residency == VideoCore::VertexCache::Residency::Resident;
+        const GLintptr loader_offset = resident ? data.offset : buffer_offset;
+        state.draw.vertex_buffer =
+            resident ? vertex_cache_buffer.GetHandle() : vertex_buffer.GetHandle();
+        state.Apply();
+
         u32 offset = 0;
         for (u32 comp = 0; comp < loader.component_count && comp < 12; ++comp) {
             u32 attribute_index = loader.GetComponent(comp);
@@ -394,7 +483,7 @@ void RasterizerOpenGL::SetupVertexArray(u8* array_ptr, GLintptr buffer_offset,
                     GLenum type = MakeAttributeType(vertex_attributes.GetFormat(attribute_index));
                     GLsizei stride = loader.byte_count;
                     glVertexAttribPointer(input_reg, size, type, GL_FALSE, stride,
-                                          reinterpret_cast<GLvoid*>(buffer_offset + offset));
+                                          reinterpret_cast<GLvoid*>(loader_offset + offset));
                     enable_attributes[input_reg] = true;
 
                     offset += vertex_attributes.GetStride(attribute_index);
@@ -407,19 +496,20 @@ void RasterizerOpenGL::SetupVertexArray(u8* array_ptr, GLintptr buffer_offset,
             }
         }
 
-        const PAddr data_addr =
-            base_address + loader.data_offset + (vs_input_index_min * loader.byte_count);
-
-        const u32 vertex_num = vs_input_index_max - vs_input_index_min + 1;
-        const u32 data_size = loader.byte_count * vertex_num;
+        if (resident) {
+            continue;
+        }
 
-        res_cache.FlushRegion(data_addr, data_size);
-        std::memcpy(array_ptr, memory.GetPhysicalPointer(data_addr), data_size);
+        std::memcpy(array_ptr, memory.GetPhysicalPointer(data.key.addr), data.key.size);
 
-        array_ptr += data_size;
-        buffer_offset += data_size;
+        array_ptr += data.key.size;
+        buffer_offset += data.key.size;
     }
 
+    // The caller unmaps the stream buffer through the GL_ARRAY_BUFFER binding.
+    state.draw.vertex_buffer = vertex_buffer.GetHandle();
+    state.Apply();
+
     for (std::size_t i = 0; i < enable_attributes.size(); ++i) {
         if (enable_attributes[i] != hw_vao_enabled_attributes[i]) {
             if (enable_attributes[i]) {
@@ -441,6 +531,48 @@ void RasterizerOpenGL::SetupVertexArray(u8* array_ptr, GLintptr buffer_offset,
     }
 }
 
+GLintptr RasterizerOpenGL::SetupIndexArray() {
+    const bool index_u16 = regs.pipeline.index_array.format != 0;
+    const u32 index_buffer_size = regs.pipeline.num_vertices * (index_u16 ? 2 : 1);
+    const PAddr index_addr = regs.pipeline.vertex_attributes.GetPhysicalBaseAddress() +
+                             regs.pipeline.index_array.offset;
+
+    const VideoCore::VertexCache::Key key = {
+        .addr = index_addr,
+        .size = index_buffer_size,
+        .layout = index_u16 ? 2U : 1U,
+    };
+    const auto [residency, cached_offset] = index_cache.Lookup(key);
+    if (residency == VideoCore::VertexCache::Residency::Resident) {
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_cache_buffer.GetHandle());
+        return cached_offset;
+    }
+
+    const bool upload = residency == VideoCore::VertexCache::Residency::Upload;
+    OGLStreamBuffer& buffer = upload ? index_cache_buffer : index_buffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer.GetHandle());
+
+    const auto [buffer_ptr, buffer_offset, invalidate] = buffer.Map(index_buffer_size, 4);
+    if (upload && invalidate) {
+        index_cache.Clear();
+    }
+    std::memcpy(buffer_ptr, memory.GetPhysicalPointer(index_addr), index_buffer_size);
+    buffer.Unmap(index_buffer_size);
+    if (upload) {
+        index_cache.Insert(key, static_cast<u32>(buffer_offset));
+    }
+    return buffer_offset;
+}
+
+void RasterizerOpenGL::InvalidateDownloadedVertexData() {
+    for (const auto& interval : res_cache.TakeDownloadedRegions()) {
+        const PAddr addr = boost::icl::first(interval);
+        const u32 size = boost::icl::length(interval);
+        vertex_cache.InvalidateRegion(addr, size);
+        index_cache.InvalidateRegion(addr, size);
+    }
+}
+
 bool RasterizerOpenGL::SetupVertexShader() {
     MICROPROFILE_SCOPE(OpenGL_VS);
     return curr_shader_manager->UseProgrammableVertexShader(regs, pica.vs_setup, accurate_mul);
@@ -525,13 +657,7 @@ bool RasterizerOpenGL::AccelerateDrawBatchInternal(bool is_indexed) {
             return false;
         }
 
-        const u8* index_data =
-            memory.GetPhysicalPointer(regs.pipeline.vertex_attributes.GetPhysicalBaseAddress() +
-                                      regs.pipeline.index_array.offset);
-        std::tie(buffer_ptr, buffer_offset, std::ignore) = index_buffer.Map(index_buffer_size, 4);
-        std::memcpy(buffer_ptr, index_data, index_buffer_size);
-        index_buffer.Unmap(index_buffer_size);
-
+        buffer_offset = SetupIndexArray();
         glDrawRangeElementsBaseVertex(primitive_mode, vertex_array_info.vs_input_index_min,
                                       vertex_array_info.vs_input_index_max,
                                       regs.pipeline.num_vertices,
@@ -828,14 +954,20 @@ void RasterizerOpenGL::FlushRegion(PAddr addr, u32 size) {
 
 void RasterizerOpenGL::InvalidateRegion(PAddr addr, u32 size) {
     res_cache.InvalidateRegion(addr, size);
+    vertex_cache.InvalidateRegion(addr, size);
+    index_cache.InvalidateRegion(addr, size);
 }
 
 void RasterizerOpenGL::FlushAndInvalidateRegion(PAddr addr, u32 size) {
     res_cache.FlushRegion(addr, size);
     res_cache.InvalidateRegion(addr, size);
+    vertex_cache.InvalidateRegion(addr, size);
+    index_cache.InvalidateRegion(addr, size);
 }
 
 void RasterizerOpenGL::ClearAll(bool flush) {
+    vertex_cache.Clear();
+    index_cache.Clear();
     res_cache.ClearAll(flush);
 }
 
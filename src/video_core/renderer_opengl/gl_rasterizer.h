@@ -9,6 +9,7 @@
 #include "video_core/renderer_opengl/gl_shader_manager.h"
 #include "video_core/renderer_opengl/gl_state.h"
 #include "video_core/renderer_opengl/gl_stream_buffer.h"
+#include "video_core/vertex_cache.h"
 #include "video_core/renderer_opengl/gl_texture_runtime.h"
 
 namespace VideoCore {
@@ -96,6 +97,12 @@ private:
     void SetupVertexArray(u8* array_ptr, GLintptr buffer_offset, GLuint vs_input_index_min,
                           GLuint vs_input_index_max);
 
+    /// Setup index array for AccelerateDrawBatch, returns the offset of the indices
+    GLintptr SetupIndexArray();
+
+    /// Drops the cached copies of vertex and index data overwritten by surface downloads
+    void InvalidateDownloadedVertexData();
+
     /// Setup vertex shader for AccelerateDrawBatch
     bool SetupVertexShader();
 
@@ -120,6 +127,10 @@ private:
     OGLStreamBuffer index_buffer;
     OGLStreamBuffer texture_buffer;
     OGLStreamBuffer texture_lf_buffer;
+    OGLStreamBuffer vertex_cache_buffer; // Vertex data kept across draws
+    OGLStreamBuffer index_cache_buffer;  // Index data kept across draws
+    VideoCore::VertexCache vertex_cache;
+    VideoCore::VertexCache index_cache;
     GLint uniform_buffer_alignment;
     std::size_t uniform_size_aligned_vs_pica;
     std::size_t uniform_size_aligned_vs;
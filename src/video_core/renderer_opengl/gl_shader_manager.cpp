@@ -257,7 +257,60 @@ using ProgrammableVertexShaders =
 using FixedGeometryShaders =
     ShaderCache<PicaFixedGSConfig, &GLSL::GenerateFixedGeometryShader, GL_GEOMETRY_SHADER>;
 
-using FragmentShaders = ShaderCache<FSConfig, &GLSL::GenerateFragmentShader, GL_FRAGMENT_SHADER>;
+// This is a cache for the fragment shaders. The first cache matches the config built from the PICA
+// registers. On cache miss, the config is canonicalized and matched against the second cache, so
+// configs that only differ in fields the generator ignores share the same shader.
+class FragmentShaders {
+public:
+    explicit FragmentShaders(bool separable_) : separable{separable_} {}
+
+    ~FragmentShaders() {
+        if (!raw_shaders.empty()) {
+            LOG_INFO(Render_OpenGL, "Fragment shader configs: {} raw, {} canonical",
+                     raw_shaders.size(), shaders.size());
+        }
+    }
+
+    std::tuple<u64, GLuint, std::optional<std::string>> Get(const FSConfig& config,
+                                                            const Pica::Shader::UserConfig& user,
+                                                            const Pica::Shader::Profile& profile) {
+        auto [raw_iter, new_raw_config] = raw_shaders.try_emplace(config.Hash());
+        if (!new_raw_config) {
+            const auto& [hash, cached_shader] = raw_iter->second;
+            return {hash, cached_shader->GetHandle(), std::nullopt};
+        }
+
+        FSConfig canonical_config = config;
+        canonical_config.Canonicalize();
+        auto [iter, new_shader] =
+            shaders.emplace(canonical_config.Hash(), OGLShaderStage{separable});
+        OGLShaderStage& cached_shader = iter->second;
+        raw_iter->second = {iter->first, &cached_shader};
+
+        std::optional<std::string> result{};
+        if (new_shader) {
+            result = GLSL::GenerateFragmentShader(canonical_config, user, profile);
+            cached_shader.Create(result->c_str(), GL_FRAGMENT_SHADER);
+        }
+        return {iter->first, cached_shader.GetHandle(), std::move(result)};
+    }
+
+    void Inject(FSConfig key, OGLProgram&& program) {
+        OGLShaderStage stage{separable};
+        stage.Inject(std::move(program));
+        Inject(key, std::move(stage));
+    }
+
+    void Inject(FSConfig key, OGLShaderStage&& stage) {
+        key.Canonicalize();
+        shaders.emplace(key.Hash(), std::move(stage));
+    }
+
+private:
+    bool separable;
+    std::unordered_map<u64, OGLShaderStage> shaders;
+    std::unordered_map<u64, std::pair<u64, OGLShaderStage*>> raw_shaders;
+};
 
 class ShaderProgramManager::Impl {
 public:
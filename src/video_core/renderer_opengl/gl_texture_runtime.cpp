@@ -149,6 +149,11 @@ VideoCore::StagingData TextureRuntime::FindStaging(u32 size, bool upload) {
     };
 }
 
+std::optional<VideoCore::StagingData> TextureRuntime::DecodeTiled(
+    const VideoCore::SurfaceParams& params, std::span<const u8> data) {
+    return std::nullopt;
+}
+
 const FormatTuple& TextureRuntime::GetFormatTuple(PixelFormat pixel_format) const {
     if (pixel_format == PixelFormat::Invalid) {
         return DEFAULT_TUPLE;
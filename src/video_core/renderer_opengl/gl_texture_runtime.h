@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <optional>
+#include <span>
 #include "video_core/rasterizer_cache/framebuffer_base.h"
 #include "video_core/rasterizer_cache/rasterizer_cache_base.h"
 #include "video_core/rasterizer_cache/surface_base.h"
@@ -55,6 +57,20 @@ public:
     /// Maps an internal staging buffer of the provided size of pixel uploads/downloads
     VideoCore::StagingData FindStaging(u32 size, bool upload);
 
+    /// Downloads wait for the GPU, there is no benefit in starting them ahead of time.
+    bool SupportsAsyncDownload() const noexcept {
+        return false;
+    }
+
+    /// Downloads started with Surface::DownloadAsync are already complete.
+    bool FinishDownload(u64 fence, const VideoCore::StagingData& staging) {
+        return true;
+    }
+
+    /// Tiled uploads are always decoded on the CPU, so this returns std::nullopt.
+    std::optional<VideoCore::StagingData> DecodeTiled(const VideoCore::SurfaceParams& params,
+                                                      std::span<const u8> data);
+
     /// Returns the OpenGL format tuple associated with the provided pixel format
     const FormatTuple& GetFormatTuple(VideoCore::PixelFormat pixel_format) const;
     const FormatTuple& GetFormatTuple(VideoCore::CustomPixelFormat pixel_format);
@@ -131,6 +147,13 @@ public:
     void Download(const VideoCore::BufferTextureCopy& download,
                   const VideoCore::StagingData& staging);
 
+    /// Downloads pixel data to staging, as OpenGL has no asynchronous download path.
+    u64 DownloadAsync(const VideoCore::BufferTextureCopy& download,
+                      const VideoCore::StagingData& staging) {
+        Download(download, staging);
+        return 0;
+    }
+
     /// Attaches a handle of surface to the specified framebuffer target
     void Attach(GLenum target, u32 level, u32 layer, bool scaled = true);
 
@@ -5,6 +5,7 @@
 #include "common/hash.h"
 #include "common/settings.h"
 #include "common/vector_math.h"
+#include "video_core/rasterizer_cache/surface_params.h"
 #include "video_core/renderer_vulkan/vk_blit_helper.h"
 #include "video_core/renderer_vulkan/vk_descriptor_update_queue.h"
 #include "video_core/renderer_vulkan/vk_instance.h"
@@ -17,6 +18,7 @@
 #include "video_core/host_shaders/full_screen_triangle_vert.h"
 #include "video_core/host_shaders/vulkan_blit_depth_stencil_frag.h"
 #include "video_core/host_shaders/vulkan_depth_to_buffer_comp.h"
+#include "video_core/host_shaders/vulkan_texture_decode_comp.h"
 
 // Texture filtering shader includes
 #include "video_core/host_shaders/texture_filtering/bicubic_frag.h"
@@ -63,6 +65,23 @@ constexpr std::array<vk::DescriptorSetLayoutBinding, 3> COMPUTE_BUFFER_BINDINGS
     {2, vk::DescriptorType::eStorageBuffer, 1, vk::ShaderStageFlagBits::eCompute},
 }};
 
+struct DecodeInfo {
+    u32 format;
+    u32 width;
+    u32 height;
+};
+
+inline constexpr vk::PushConstantRange DECODE_PUSH_CONSTANT_RANGE{
+    .stageFlags = vk::ShaderStageFlagBits::eCompute,
+    .offset = 0,
+    .size = sizeof(DecodeInfo),
+};
+
+constexpr std::array<vk::DescriptorSetLayoutBinding, 2> DECODE_BINDINGS = {{
+    {0, vk::DescriptorType::eStorageBuffer, 1, vk::ShaderStageFlagBits::eCompute},
+    {1, vk::DescriptorType::eStorageBuffer, 1, vk::ShaderStageFlagBits::eCompute},
+}};
+
 constexpr std::array<vk::DescriptorSetLayoutBinding, 2> TWO_TEXTURES_BINDINGS = {{
     {0, vk::DescriptorType::eCombinedImageSampler, 1, vk::ShaderStageFlagBits::eFragment},
     {1, vk::DescriptorType::eCombinedImageSampler, 1, vk::ShaderStageFlagBits::eFragment},
@@ -234,6 +253,7 @@ BlitHelper::BlitHelper(const Instance& instance_, Scheduler& scheduler_,
                               16},
       three_textures_provider{instance, scheduler.GetMasterSemaphore(), THREE_TEXTURES_BINDINGS,
                               16},
+      decode_provider{instance, scheduler.GetMasterSemaphore(), DECODE_BINDINGS},
       compute_pipeline_layout{
           device.createPipelineLayout(PipelineLayoutCreateInfo(&compute_provider.Layout(), true))},
       compute_buffer_pipeline_layout{device.createPipelineLayout(
@@ -244,12 +264,20 @@ BlitHelper::BlitHelper(const Instance& instance_, Scheduler& scheduler_,
           PipelineLayoutCreateInfo(&single_texture_provider.Layout(), false, true))},
       three_textures_pipeline_layout{device.createPipelineLayout(
           PipelineLayoutCreateInfo(&three_textures_provider.Layout(), false, true))},
+      decode_pipeline_layout{device.createPipelineLayout(vk::PipelineLayoutCreateInfo{
+          .setLayoutCount = 1,
+          .pSetLayouts = &decode_provider.Layout(),
+          .pushConstantRangeCount = 1,
+          .pPushConstantRanges = &DECODE_PUSH_CONSTANT_RANGE,
+      })},
       full_screen_vert{Compile(HostShaders::FULL_SCREEN_TRIANGLE_VERT,
                                vk::ShaderStageFlagBits::eVertex, device)},
       d24s8_to_rgba8_comp{Compile(HostShaders::VULKAN_D24S8_TO_RGBA8_COMP,
                                   vk::ShaderStageFlagBits::eCompute, device)},
       depth_to_buffer_comp{Compile(HostShaders::VULKAN_DEPTH_TO_BUFFER_COMP,
                                    vk::ShaderStageFlagBits::eCompute, device)},
+      texture_decode_comp{Compile(HostShaders::VULKAN_TEXTURE_DECODE_COMP,
+                                  vk::ShaderStageFlagBits::eCompute, device)},
       blit_depth_stencil_frag{VK_NULL_HANDLE},
       // Texture filtering shader modules
       bicubic_frag{Compile(HostShaders::BICUBIC_FRAG, vk::ShaderStageFlagBits::eFragment, device)},
@@ -262,6 +290,7 @@ BlitHelper::BlitHelper(const Instance& instance_, Scheduler& scheduler_,
       d24s8_to_rgba8_pipeline{MakeComputePipeline(d24s8_to_rgba8_comp, compute_pipeline_layout)},
       depth_to_buffer_pipeline{
           MakeComputePipeline(depth_to_buffer_comp, compute_buffer_pipeline_layout)},
+      texture_decode_pipeline{MakeComputePipeline(texture_decode_comp, decode_pipeline_layout)},
       depth_blit_pipeline{VK_NULL_HANDLE},
       linear_sampler{device.createSampler(SAMPLER_CREATE_INFO<vk::Filter::eLinear>)},
       nearest_sampler{device.createSampler(SAMPLER_CREATE_INFO<vk::Filter::eNearest>)} {
@@ -282,14 +311,17 @@ BlitHelper::BlitHelper(const Instance& instance_, Scheduler& scheduler_,
                       "BlitHelper: single_texture_pipeline_layout");
         SetObjectName(device, three_textures_pipeline_layout,
                       "BlitHelper: three_textures_pipeline_layout");
+        SetObjectName(device, decode_pipeline_layout, "BlitHelper: decode_pipeline_layout");
         SetObjectName(device, full_screen_vert, "BlitHelper: full_screen_vert");
         SetObjectName(device, d24s8_to_rgba8_comp, "BlitHelper: d24s8_to_rgba8_comp");
         SetObjectName(device, depth_to_buffer_comp, "BlitHelper: depth_to_buffer_comp");
+        SetObjectName(device, texture_decode_comp, "BlitHelper: texture_decode_comp");
         if (blit_depth_stencil_frag) {
             SetObjectName(device, blit_depth_stencil_frag, "BlitHelper: blit_depth_stencil_frag");
         }
         SetObjectName(device, d24s8_to_rgba8_pipeline, "BlitHelper: d24s8_to_rgba8_pipeline");
         SetObjectName(device, depth_to_buffer_pipeline, "BlitHelper: depth_to_buffer_pipeline");
+        SetObjectName(device, texture_decode_pipeline, "BlitHelper: texture_decode_pipeline");
         if (depth_blit_pipeline) {
             SetObjectName(device, depth_blit_pipeline, "BlitHelper: depth_blit_pipeline");
         }
@@ -308,9 +340,11 @@ BlitHelper::~BlitHelper() {
     device.destroyPipelineLayout(two_textures_pipeline_layout);
     device.destroyPipelineLayout(single_texture_pipeline_layout);
     device.destroyPipelineLayout(three_textures_pipeline_layout);
+    device.destroyPipelineLayout(decode_pipeline_layout);
     device.destroyShaderModule(full_screen_vert);
     device.destroyShaderModule(d24s8_to_rgba8_comp);
     device.destroyShaderModule(depth_to_buffer_comp);
+    device.destroyShaderModule(texture_decode_comp);
     if (blit_depth_stencil_frag) {
         device.destroyShaderModule(blit_depth_stencil_frag);
     }
@@ -322,6 +356,7 @@ BlitHelper::~BlitHelper() {
     device.destroyShaderModule(refine_frag);
     device.destroyPipeline(depth_to_buffer_pipeline);
     device.destroyPipeline(d24s8_to_rgba8_pipeline);
+    device.destroyPipeline(texture_decode_pipeline);
     device.destroyPipeline(depth_blit_pipeline);
     device.destroySampler(linear_sampler);
     device.destroySampler(nearest_sampler);
@@ -585,6 +620,51 @@ bool BlitHelper::DepthToBuffer(Surface& source, vk::Buffer buffer,
     return true;
 }
 
+void BlitHelper::DecodeTexture(const VideoCore::SurfaceParams& params, vk::Buffer buffer,
+                               vk::DeviceSize src_offset, vk::DeviceSize dst_offset) {
+    const vk::DeviceSize src_size = params.end - params.addr;
+    const vk::DeviceSize dst_size = params.width * params.height * sizeof(u32);
+
+    const auto descriptor_set = decode_provider.Commit();
+    update_queue.AddBuffer(descriptor_set, 0, buffer, src_offset, src_size,
+                           vk::DescriptorType::eStorageBuffer);
+    update_queue.AddBuffer(descriptor_set, 1, buffer, dst_offset, dst_size,
+                           vk::DescriptorType::eStorageBuffer);
+
+    const DecodeInfo info = {
+        .format = static_cast<u32>(params.pixel_format),
+        .width = params.width,
+        .height = params.height,
+    };
+
+    renderpass_cache.EndRendering();
+    scheduler.Record([this, descriptor_set, info, buffer, dst_offset,
+                      dst_size](vk::CommandBuffer cmdbuf) {
+        const vk::BufferMemoryBarrier post_barrier = {
+            .srcAccessMask = vk::AccessFlagBits::eShaderWrite,
+            .dstAccessMask = vk::AccessFlagBits::eTransferRead,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .buffer = buffer,
+            .offset = dst_offset,
+            .size = dst_size,
+        };
+
+        cmdbuf.bindDescriptorSets(vk::PipelineBindPoint::eCompute, decode_pipeline_layout, 0,
+                                  descriptor_set, {});
+        cmdbuf.bindPipeline(vk::PipelineBindPoint::eCompute, texture_decode_pipeline);
+        cmdbuf.pushConstants(decode_pipeline_layout, vk::ShaderStageFlagBits::eCompute, 0,
+                             sizeof(info), &info);
+
+        // Each workgroup decodes a single 8x8 tile.
+        cmdbuf.dispatch(info.width / 8, info.height / 8, 1);
+
+        cmdbuf.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader,
+                               vk::PipelineStageFlagBits::eTransfer,
+                               vk::DependencyFlagBits::eByRegion, {}, post_barrier, {});
+    });
+}
+
 vk::Pipeline BlitHelper::MakeComputePipeline(vk::ShaderModule shader, vk::PipelineLayout layout) {
     const vk::ComputePipelineCreateInfo compute_info = {
         .stage = MakeStages(shader),
@@ -13,6 +13,7 @@ namespace VideoCore {
 struct TextureBlit;
 struct TextureCopy;
 struct BufferTextureCopy;
+class SurfaceParams;
 } // namespace VideoCore
 
 namespace Vulkan {
@@ -39,6 +40,11 @@ public:
     bool DepthToBuffer(Surface& source, vk::Buffer buffer,
                        const VideoCore::BufferTextureCopy& copy);
 
+    /// Decodes the morton tiled texels at src_offset of buffer to linear RGBA8 texels at
+    /// dst_offset, in the layout Surface::Upload expects.
+    void DecodeTexture(const VideoCore::SurfaceParams& params, vk::Buffer buffer,
+                       vk::DeviceSize src_offset, vk::DeviceSize dst_offset);
+
 private:
     vk::Pipeline MakeComputePipeline(vk::ShaderModule shader, vk::PipelineLayout layout);
     vk::Pipeline MakeDepthStencilBlitPipeline();
@@ -75,15 +81,18 @@ private:
     DescriptorHeap two_textures_provider;
     DescriptorHeap single_texture_provider;
     DescriptorHeap three_textures_provider;
+    DescriptorHeap decode_provider;
     vk::PipelineLayout compute_pipeline_layout;
     vk::PipelineLayout compute_buffer_pipeline_layout;
     vk::PipelineLayout two_textures_pipeline_layout;
     vk::PipelineLayout single_texture_pipeline_layout;
     vk::PipelineLayout three_textures_pipeline_layout;
+    vk::PipelineLayout decode_pipeline_layout;
 
     vk::ShaderModule full_screen_vert;
     vk::ShaderModule d24s8_to_rgba8_comp;
     vk::ShaderModule depth_to_buffer_comp;
+    vk::ShaderModule texture_decode_comp;
     vk::ShaderModule blit_depth_stencil_frag;
     vk::ShaderModule bicubic_frag;
     vk::ShaderModule scale_force_frag;
@@ -93,6 +102,7 @@ private:
 
     vk::Pipeline d24s8_to_rgba8_pipeline;
     vk::Pipeline depth_to_buffer_pipeline;
+    vk::Pipeline texture_decode_pipeline;
     vk::Pipeline depth_blit_pipeline;
     vk::Sampler linear_sampler;
     vk::Sampler nearest_sampler;
@@ -101,9 +101,16 @@ bool GraphicsPipeline::TryBuild(bool wait_built) {
     }
 
     // Fallback to (a)synchronous compilation
+    BuildAsync();
+    return wait_built;
+}
+
+void GraphicsPipeline::BuildAsync() {
+    if (is_pending) {
+        return;
+    }
     worker->QueueWork([this] { Build(); });
     is_pending = true;
-    return wait_built;
 }
 
 bool GraphicsPipeline::Build(bool fail_on_compile_required) {
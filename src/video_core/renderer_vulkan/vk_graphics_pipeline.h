@@ -320,6 +320,9 @@ public:
 
     bool TryBuild(bool wait_built);
 
+    /// Queues the pipeline build on the worker, which waits for any shader still compiling.
+    void BuildAsync();
+
     bool Build(bool fail_on_compile_required = false);
 
     [[nodiscard]] vk::Pipeline Handle() const noexcept {
@@ -370,14 +370,24 @@ bool PipelineCache::BindPipeline(PipelineInfo& info, bool wait_built) {
         info.state.shader_ids[i] = shader_hashes[i];
     }
 
-    GraphicsPipeline* const pipeline = curr_disk_cache->GetPipeline(info);
-    if (!pipeline->IsDone() && !pipeline->TryBuild(wait_built)) {
-        return false;
+    GraphicsPipeline* pipeline = curr_disk_cache->GetPipeline(info);
+    if (!pipeline->IsDone() && !pipeline->TryBuild(false)) {
+        // Draw with the uber fragment shader while the pipeline builds, if it is ready.
+        if (GraphicsPipeline* const uber_pipeline = GetUberPipeline(info)) {
+            pipeline = uber_pipeline;
+        } else if (!pipeline->TryBuild(wait_built)) {
+            return false;
+        }
     }
 
     const bool is_dirty = scheduler.IsStateDirty(StateFlags::Pipeline);
     const bool pipeline_dirty = (current_pipeline != pipeline) || is_dirty;
-    scheduler.Record([this, is_dirty, pipeline_dirty, pipeline,
+    // All rasterizer pipelines share a layout, so bound sets stay valid across pipeline changes.
+    // Pipeline dirtiness means another layout was bound, e.g. by the blit helper.
+    const bool descriptors_dirty = is_dirty || scheduler.IsStateDirty(StateFlags::DescriptorSets) ||
+                                   current_descriptor_sets != bound_descriptor_sets ||
+                                   current_offsets != offsets;
+    scheduler.Record([this, is_dirty, pipeline_dirty, descriptors_dirty, pipeline,
                       current_dynamic = current_info.dynamic_info, dynamic = info.dynamic_info,
                       descriptor_sets = bound_descriptor_sets, offsets = offsets,
                       current_rasterization = current_info.state.rasterization,
@@ -485,28 +495,33 @@ bool PipelineCache::BindPipeline(PipelineInfo& info, bool wait_built) {
             cmdbuf.bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline->Handle());
         }
 
-        cmdbuf.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, *pipeline_layout, 0,
-                                  descriptor_sets, offsets);
+        if (descriptors_dirty) {
+            cmdbuf.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, *pipeline_layout, 0,
+                                      descriptor_sets, offsets);
+        }
     });
 
     current_info = info;
     current_pipeline = pipeline;
+    current_descriptor_sets = bound_descriptor_sets;
+    current_offsets = offsets;
     scheduler.MarkStateNonDirty(StateFlags::Pipeline | StateFlags::DescriptorSets);
 
     return true;
 }
 
-ExtraVSConfig PipelineCache::CalcExtraConfig(const PicaVSConfig& config) {
+ExtraVSConfig PipelineCache::CalcExtraConfig(const PicaVSConfig& config,
+                                             const Pica::Shader::Profile& profile) {
     auto res = ExtraVSConfig();
 
     // Enable the geometry-shader only if we are actually doing per-fragment lighting
     // and care about proper quaternions. Otherwise just use standard vertex+fragment shaders.
     // We also don't need the geometry shader if we have the barycentric extension.
-    const bool use_geometry_shader = instance.UseGeometryShaders() &&
+    const bool use_geometry_shader = profile.has_geometry_shader &&
                                      !config.state.lighting_disable &&
-                                     !instance.IsFragmentShaderBarycentricSupported();
+                                     !profile.has_fragment_shader_barycentric;
 
-    res.use_clip_planes = instance.IsShaderClipDistanceSupported();
+    res.use_clip_planes = profile.has_clip_planes;
     res.use_geometry_shader = use_geometry_shader;
     res.sanitize_mul = profile.enable_accurate_mul;
     res.separable_shader = true;
@@ -517,7 +532,8 @@ ExtraVSConfig PipelineCache::CalcExtraConfig(const PicaVSConfig& config) {
         const u32 location = attr.location;
         const Pica::PipelineRegs::VertexAttributeFormat type =
             static_cast<Pica::PipelineRegs::VertexAttributeFormat>(attr.type);
-        const FormatTraits& traits = instance.GetTraits(type, attr.size);
+        // The profile holds the vertex attribute traits of the instance, see GetAllTraits
+        const auto& traits = profile.vk_format_traits[static_cast<u32>(type) * 4 + attr.size - 1];
         AttribLoadFlags& flags = res.load_flags[location];
 
         if (traits.needs_conversion) {
@@ -577,7 +593,35 @@ void PipelineCache::UseFragmentShader(const Pica::RegsInternal& regs,
     if (res.has_value()) {
         current_shaders[ProgramType::FS] = (*res).second;
         shader_hashes[ProgramType::FS] = (*res).first;
+        fs_regs = &regs;
+        fs_user = user;
+    }
+}
+
+GraphicsPipeline* PipelineCache::GetUberPipeline(PipelineInfo& info) {
+    if (!fs_regs) {
+        return nullptr;
+    }
+
+    const auto [uber_hash, uber_shader] = curr_disk_cache->UseUberFragmentShader(*fs_regs, fs_user);
+    // A null module means the uber shader failed to build
+    if (!uber_shader->IsDone() || !uber_shader->Handle()) {
+        return nullptr;
+    }
+
+    Shader* const specialised_shader = std::exchange(current_shaders[ProgramType::FS], uber_shader);
+    const u64 specialised_hash = std::exchange(shader_hashes[ProgramType::FS], uber_hash);
+    info.state.shader_ids[ProgramType::FS] = uber_hash;
+
+    GraphicsPipeline* const pipeline = curr_disk_cache->GetPipeline(info);
+
+    current_shaders[ProgramType::FS] = specialised_shader;
+    shader_hashes[ProgramType::FS] = specialised_hash;
+    if (pipeline->IsDone() || pipeline->TryBuild(false)) {
+        return pipeline;
     }
+    info.state.shader_ids[ProgramType::FS] = specialised_hash;
+    return nullptr;
 }
 
 bool PipelineCache::IsCacheValid(std::span<const u8> data) const {
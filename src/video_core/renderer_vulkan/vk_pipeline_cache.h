@@ -53,6 +53,26 @@ public:
         return descriptor_set;
     }
 
+    /**
+     * Acquires and binds a descriptor set holding the given image descriptors, reusing the set of
+     * an earlier draw in the current submission when the descriptors are unchanged.
+     * @returns The descriptor set and whether its contents have to be written.
+     */
+    std::pair<vk::DescriptorSet, bool> Acquire(DescriptorHeapType type,
+                                               std::span<const TextureDescriptor> descriptors) {
+        const u32 index = static_cast<u32>(type);
+        const auto result = descriptor_heaps[index].Commit(descriptors);
+        bound_descriptor_sets[index] = result.first;
+        return result;
+    }
+
+    /// Forgets the descriptor sets reused by contents, called on queue submission
+    void ResetDescriptorCache() {
+        for (auto& heap : descriptor_heaps) {
+            heap.ResetCache();
+        }
+    }
+
     /// Sets the dynamic offset for the uniform buffer at binding
     void UpdateRange(u8 binding, u32 offset) {
         offsets[binding] = offset;
@@ -69,8 +89,10 @@ public:
     /// Binds a pipeline using the provided information
     bool BindPipeline(PipelineInfo& info, bool wait_built = false);
 
-    Pica::Shader::Generator::ExtraVSConfig CalcExtraConfig(
-        const Pica::Shader::Generator::PicaVSConfig& config);
+    /// Computes the backend specific vertex shader options. Only depends on the profile, so
+    /// shaders can be generated without a device.
+    static Pica::Shader::Generator::ExtraVSConfig CalcExtraConfig(
+        const Pica::Shader::Generator::PicaVSConfig& config, const Pica::Shader::Profile& profile);
 
     /// Binds a PICA decompiled vertex shader
     bool UseProgrammableVertexShader(const Pica::RegsInternal& regs, Pica::ShaderSetup& setup,
@@ -122,6 +144,9 @@ private:
     /// Builds the rasterizer pipeline layout
     void BuildLayout();
 
+    /// Returns the pipeline using the uber fragment shader of the current state, if it is ready
+    GraphicsPipeline* GetUberPipeline(PipelineInfo& info);
+
     /// Returns true when the disk data can be used by the current driver
     bool IsCacheValid(std::span<const u8> cache_data) const;
 
@@ -154,9 +179,13 @@ private:
     std::array<DescriptorHeap, NumDescriptorHeaps> descriptor_heaps;
     std::array<vk::DescriptorSet, NumRasterizerSets> bound_descriptor_sets{};
     std::array<u32, NumDynamicOffsets> offsets{};
+    std::array<vk::DescriptorSet, NumRasterizerSets> current_descriptor_sets{};
+    std::array<u32, NumDynamicOffsets> current_offsets{};
 
     std::array<u64, MAX_SHADER_STAGES> shader_hashes;
     std::array<Shader*, MAX_SHADER_STAGES> current_shaders;
+    const Pica::RegsInternal* fs_regs{};
+    Pica::Shader::UserConfig fs_user{};
 
     Shader trivial_vertex_shader;
 
@@ -35,6 +35,8 @@ using namespace Pica::Shader::Generator;
 constexpr u64 STREAM_BUFFER_SIZE = 64_MiB;
 constexpr u64 UNIFORM_BUFFER_SIZE = 8_MiB;
 constexpr u64 TEXTURE_BUFFER_SIZE = 2_MiB;
+constexpr u64 VERTEX_CACHE_BUFFER_SIZE = 32_MiB;
+constexpr u64 INDEX_CACHE_BUFFER_SIZE = 8_MiB;
 
 constexpr vk::BufferUsageFlags BUFFER_USAGE =
     vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eIndexBuffer;
@@ -44,6 +46,7 @@ struct DrawParams {
     s32 vertex_offset;
     u32 binding_count;
     std::array<u32, 16> bindings;
+    u16 cached_bindings;
     bool is_indexed;
 };
 
@@ -74,6 +77,16 @@ RasterizerVulkan::RasterizerVulkan(Memory::MemorySystem& memory, Pica::PicaCore&
                      TextureBufferSize(instance)},
       texture_lf_buffer{instance, scheduler, vk::BufferUsageFlagBits::eUniformTexelBuffer,
                         TextureBufferSize(instance)},
+      vertex_cache_buffer{instance, scheduler, vk::BufferUsageFlagBits::eVertexBuffer,
+                          VERTEX_CACHE_BUFFER_SIZE},
+      index_cache_buffer{instance, scheduler, vk::BufferUsageFlagBits::eIndexBuffer,
+                         INDEX_CACHE_BUFFER_SIZE},
+      vertex_cache{[this](PAddr addr, u32 size, int delta) {
+          res_cache.UpdatePagesCachedCount(addr, size, delta);
+      }},
+      index_cache{[this](PAddr addr, u32 size, int delta) {
+          res_cache.UpdatePagesCachedCount(addr, size, delta);
+      }},
       async_shaders{Settings::values.async_shader_compilation.GetValue()} {
 
     vertex_buffers.fill(stream_buffer.Handle());
@@ -109,7 +122,10 @@ RasterizerVulkan::RasterizerVulkan(Memory::MemorySystem& memory, Pica::PicaCore&
         .range = VK_WHOLE_SIZE,
     });
 
-    scheduler.RegisterOnSubmit([&renderpass_cache] { renderpass_cache.EndRendering(); });
+    scheduler.RegisterOnSubmit([this] {
+        renderpass_cache.EndRendering();
+        pipeline_cache.ResetDescriptorCache();
+    });
 
     // Prepare the static buffer descriptor set.
     const auto buffer_set = pipeline_cache.Acquire(DescriptorHeapType::Buffer);
@@ -247,13 +263,21 @@ void RasterizerVulkan::SetupVertexArray() {
     const auto& vertex_attributes = regs.pipeline.vertex_attributes;
     const PAddr base_address = vertex_attributes.GetPhysicalBaseAddress(); // GPUREG_ATTR_BUF_BASE
     const u32 stride_alignment = instance.GetMinVertexStrideAlignment();
+    const u32 vertex_num = vs_input_index_max - vs_input_index_min + 1;
 
     VertexLayout& layout = pipeline_info.state.vertex_layout;
     layout.binding_count = 0;
     layout.attribute_count = 16;
     enable_attributes.fill(false);
 
-    u32 buffer_offset = 0;
+    struct LoaderData {
+        VideoCore::VertexCache::Key key;
+        VideoCore::VertexCache::Residency residency;
+        u32 stride;
+        u32 offset;
+    };
+    std::array<LoaderData, 12> loader_data;
+
     for (const auto& loader : vertex_attributes.attribute_loaders) {
         if (loader.component_count == 0 || loader.byte_count == 0) {
             continue;
@@ -294,10 +318,88 @@ void RasterizerVulkan::SetupVertexArray() {
 
         const PAddr data_addr =
             base_address + loader.data_offset + (vs_input_index_min * loader.byte_count);
-        const u32 vertex_num = vs_input_index_max - vs_input_index_min + 1;
-        u32 data_size = loader.byte_count * vertex_num;
+        const u32 data_size = loader.byte_count * vertex_num;
         res_cache.FlushRegion(data_addr, data_size);
 
+        // Align stride up if required by Vulkan implementation.
+        const u32 aligned_stride =
+            Common::AlignUp(static_cast<u32>(loader.byte_count), stride_alignment);
+        loader_data[layout.binding_count] = {
+            .key = {data_addr, data_size, aligned_stride},
+            .stride = loader.byte_count,
+        };
+
+        // Create the binding associated with this loader
+        VertexBinding& binding = layout.bindings[layout.binding_count];
+        binding.binding.Assign(layout.binding_count);
+        binding.fixed.Assign(0);
+        // Will be adjusted on pipeline build, to keep the info transferable.
+        binding.byte_count.Assign(loader.byte_count);
+        layout.binding_count++;
+    }
+
+    // The flushes above may have written guest memory backing cached copies.
+    InvalidateDownloadedVertexData();
+
+    // Find the loaders whose data is already resident and the size of the new copies.
+    u32 cache_size = 0;
+    for (u32 i = 0; i < layout.binding_count; i++) {
+        LoaderData& data = loader_data[i];
+        std::tie(data.residency, data.offset) = vertex_cache.Lookup(data.key);
+        if (data.residency != VideoCore::VertexCache::Residency::Upload) {
+            continue;
+        }
+        const auto is_same_upload = [&data](const LoaderData& other) {
+            return other.residency == VideoCore::VertexCache::Residency::Upload &&
+                   other.key == data.key;
+        };
+        if (std::any_of(loader_data.begin(), loader_data.begin() + i, is_same_upload)) {
+            // Another loader reads the same data, only copy it once to the cache.
+            data.residency = VideoCore::VertexCache::Residency::Stream;
+            continue;
+        }
+        const u32 copy_size = Common::AlignUp(data.key.layout * vertex_num, 4);
+        if (cache_size + copy_size > VERTEX_CACHE_BUFFER_SIZE / 4) {
+            // Stride alignment can inflate the copies, keep each draw to a part of the buffer.
+            data.residency = VideoCore::VertexCache::Residency::Stream;
+            continue;
+        }
+        cache_size += copy_size;
+    }
+
+    u8* cache_ptr = nullptr;
+    u32 cache_offset = 0;
+    if (cache_size > 0) {
+        const auto [ptr, offset, cache_invalidate] = vertex_cache_buffer.Map(cache_size, 16);
+        if (cache_invalidate) {
+            // The buffer wrapped around, wait for the draws reading the previous copies
+            // before they are overwritten and stream the loaders which used them.
+            scheduler.Wait(vertex_cache_tick);
+            vertex_cache.Clear();
+            for (u32 i = 0; i < layout.binding_count; i++) {
+                LoaderData& data = loader_data[i];
+                if (data.residency == VideoCore::VertexCache::Residency::Resident) {
+                    data.residency = VideoCore::VertexCache::Residency::Stream;
+                }
+            }
+        }
+        cache_ptr = ptr;
+        cache_offset = offset;
+    }
+
+    cached_bindings = 0;
+    u32 buffer_offset = 0;
+    u32 cache_buffer_offset = 0;
+    for (u32 i = 0; i < layout.binding_count; i++) {
+        const LoaderData& data = loader_data[i];
+        const auto [data_addr, data_size, aligned_stride] = data.key;
+
+        if (data.residency == VideoCore::VertexCache::Residency::Resident) {
+            cached_bindings |= 1U << i;
+            binding_offsets[i] = data.offset;
+            continue;
+        }
+
         const MemoryRef src_ref = memory.GetPhysicalRef(data_addr);
         if (src_ref.GetSize() < data_size) {
             LOG_ERROR(Render_Vulkan,
@@ -305,34 +407,35 @@ void RasterizerVulkan::SetupVertexArray() {
                       data_size, src_ref.GetSize(), data_addr);
         }
 
+        const bool upload = data.residency == VideoCore::VertexCache::Residency::Upload;
+        u32& dst_offset = upload ? cache_buffer_offset : buffer_offset;
         const u8* src_ptr = src_ref.GetPtr();
-        u8* dst_ptr = array_ptr + buffer_offset;
+        u8* dst_ptr = (upload ? cache_ptr : array_ptr) + dst_offset;
 
-        // Align stride up if required by Vulkan implementation.
-        const u32 aligned_stride =
-            Common::AlignUp(static_cast<u32>(loader.byte_count), stride_alignment);
-        if (aligned_stride == loader.byte_count) {
+        if (aligned_stride == data.stride) {
             std::memcpy(dst_ptr, src_ptr, data_size);
         } else {
             for (std::size_t vertex = 0; vertex < vertex_num; vertex++) {
-                std::memcpy(dst_ptr + vertex * aligned_stride, src_ptr + vertex * loader.byte_count,
-                            loader.byte_count);
+                std::memcpy(dst_ptr + vertex * aligned_stride, src_ptr + vertex * data.stride,
+                            data.stride);
             }
         }
 
-        // Create the binding associated with this loader
-        VertexBinding& binding = layout.bindings[layout.binding_count];
-        binding.binding.Assign(layout.binding_count);
-        binding.fixed.Assign(0);
-        // Will be adjusted on pipeline build, to keep the info transferable.
-        binding.byte_count.Assign(loader.byte_count);
-
         // Keep track of the binding offsets so we can bind the vertex buffer later
-        binding_offsets[layout.binding_count++] = static_cast<u32>(array_offset + buffer_offset);
-        buffer_offset += Common::AlignUp(aligned_stride * vertex_num, 4);
+        if (upload) {
+            vertex_cache.Insert(data.key, cache_offset + dst_offset);
+            cached_bindings |= 1U << i;
+            binding_offsets[i] = cache_offset + dst_offset;
+        } else {
+            binding_offsets[i] = static_cast<u32>(array_offset + dst_offset);
+        }
+        dst_offset += Common::AlignUp(aligned_stride * vertex_num, 4);
     }
 
     stream_buffer.Commit(buffer_offset);
+    if (cache_size > 0) {
+        vertex_cache_buffer.Commit(cache_buffer_offset);
+    }
 
     // Assign the rest of the attributes to the last binding
     SetupFixedAttribs();
@@ -451,6 +554,9 @@ bool RasterizerVulkan::AccelerateDrawBatch(bool is_indexed) {
         return true;
     }
     SetupVertexArray();
+    if (is_indexed) {
+        SetupIndexArray();
+    }
 
     if (!SetupVertexShader()) {
         return false;
@@ -463,10 +569,6 @@ bool RasterizerVulkan::AccelerateDrawBatch(bool is_indexed) {
 }
 
 bool RasterizerVulkan::AccelerateDrawBatchInternal(bool is_indexed) {
-    if (is_indexed) {
-        SetupIndexArray();
-    }
-
     const bool wait_built = !async_shaders || regs.pipeline.num_vertices <= 6;
     if (!pipeline_cache.BindPipeline(pipeline_info, wait_built)) {
         return true;
@@ -477,14 +579,34 @@ bool RasterizerVulkan::AccelerateDrawBatchInternal(bool is_indexed) {
         .vertex_offset = -static_cast<s32>(vertex_info.vs_input_index_min),
         .binding_count = pipeline_info.state.vertex_layout.binding_count,
         .bindings = binding_offsets,
+        .cached_bindings = cached_bindings,
         .is_indexed = is_indexed,
     };
 
+    if (cached_bindings != 0) {
+        vertex_cache_tick = scheduler.CurrentTick();
+    }
+    if (is_indexed) {
+        if (index_buffer == index_cache_buffer.Handle()) {
+            index_cache_tick = scheduler.CurrentTick();
+        }
+        scheduler.Record([buffer = index_buffer, offset = index_offset,
+                          type = index_type](vk::CommandBuffer cmdbuf) {
+            cmdbuf.bindIndexBuffer(buffer, offset, type);
+        });
+    }
+
     scheduler.Record([this, params](vk::CommandBuffer cmdbuf) {
         std::array<vk::DeviceSize, 16> offsets;
         std::transform(params.bindings.begin(), params.bindings.end(), offsets.begin(),
                        [](u32 offset) { return static_cast<vk::DeviceSize>(offset); });
-        cmdbuf.bindVertexBuffers(0, params.binding_count, vertex_buffers.data(), offsets.data());
+        std::array<vk::Buffer, 16> buffers = vertex_buffers;
+        for (u32 i = 0; i < params.binding_count; i++) {
+            if (params.cached_bindings & (1U << i)) {
+                buffers[i] = vertex_cache_buffer.Handle();
+            }
+        }
+        cmdbuf.bindVertexBuffers(0, params.binding_count, buffers.data(), offsets.data());
         if (params.is_indexed) {
             cmdbuf.drawIndexed(params.vertex_count, 1, 0, params.vertex_offset, 0);
         } else {
@@ -498,14 +620,34 @@ bool RasterizerVulkan::AccelerateDrawBatchInternal(bool is_indexed) {
 void RasterizerVulkan::SetupIndexArray() {
     const bool index_u8 = regs.pipeline.index_array.format == 0;
     const bool native_u8 = index_u8 && instance.IsIndexTypeUint8Supported();
-    const u32 index_buffer_size = regs.pipeline.num_vertices * (native_u8 ? 1 : 2);
-    const vk::IndexType index_type = native_u8 ? vk::IndexType::eUint8EXT : vk::IndexType::eUint16;
-
-    const u8* index_data =
-        memory.GetPhysicalPointer(regs.pipeline.vertex_attributes.GetPhysicalBaseAddress() +
-                                  regs.pipeline.index_array.offset);
+    const u32 index_size = native_u8 ? 1 : 2;
+    const u32 index_buffer_size = regs.pipeline.num_vertices * index_size;
+    index_type = native_u8 ? vk::IndexType::eUint8EXT : vk::IndexType::eUint16;
+
+    const PAddr index_addr = regs.pipeline.vertex_attributes.GetPhysicalBaseAddress() +
+                             regs.pipeline.index_array.offset;
+    const u8* index_data = memory.GetPhysicalPointer(index_addr);
+
+    const VideoCore::VertexCache::Key key = {
+        .addr = index_addr,
+        .size = regs.pipeline.num_vertices * (index_u8 ? 1 : 2),
+        .layout = index_size,
+    };
+    auto [residency, cached_offset] = index_cache.Lookup(key);
+    if (residency == VideoCore::VertexCache::Residency::Resident) {
+        index_buffer = index_cache_buffer.Handle();
+        index_offset = cached_offset;
+        return;
+    }
 
-    auto [index_ptr, index_offset, _] = stream_buffer.Map(index_buffer_size, 2);
+    const bool upload = residency == VideoCore::VertexCache::Residency::Upload;
+    StreamBuffer& buffer = upload ? index_cache_buffer : stream_buffer;
+    auto [index_ptr, offset, invalidate] = buffer.Map(index_buffer_size, 4);
+    if (upload && invalidate) {
+        // The buffer wrapped around, wait for the draws reading the previous copies.
+        scheduler.Wait(index_cache_tick);
+        index_cache.Clear();
+    }
 
     if (index_u8 && !native_u8) {
         u16* index_ptr_u16 = reinterpret_cast<u16*>(index_ptr);
@@ -516,12 +658,22 @@ void RasterizerVulkan::SetupIndexArray() {
         std::memcpy(index_ptr, index_data, index_buffer_size);
     }
 
-    stream_buffer.Commit(index_buffer_size);
+    buffer.Commit(index_buffer_size);
+    if (upload) {
+        index_cache.Insert(key, offset);
+    }
 
-    scheduler.Record(
-        [this, index_offset = index_offset, index_type = index_type](vk::CommandBuffer cmdbuf) {
-            cmdbuf.bindIndexBuffer(stream_buffer.Handle(), index_offset, index_type);
-        });
+    index_buffer = buffer.Handle();
+    index_offset = offset;
+}
+
+void RasterizerVulkan::InvalidateDownloadedVertexData() {
+    for (const auto& interval : res_cache.TakeDownloadedRegions()) {
+        const PAddr addr = boost::icl::first(interval);
+        const u32 size = boost::icl::length(interval);
+        vertex_cache.InvalidateRegion(addr, size);
+        index_cache.InvalidateRegion(addr, size);
+    }
 }
 
 void RasterizerVulkan::DrawTriangles() {
@@ -629,10 +781,7 @@ void RasterizerVulkan::SyncTextureUnits(const Framebuffer* framebuffer) {
     using TextureType = Pica::TexturingRegs::TextureConfig::TextureType;
 
     const auto pica_textures = regs.texturing.GetTextures();
-    const bool use_cube_heap =
-        pica_textures[0].enabled && pica_textures[0].config.type == TextureType::ShadowCube;
-    const auto texture_set = pipeline_cache.Acquire(use_cube_heap ? DescriptorHeapType::Texture
-                                                                  : DescriptorHeapType::Texture);
+    texture_descriptors.clear();
 
     for (u32 texture_index = 0; texture_index < pica_textures.size(); ++texture_index) {
         const auto& texture = pica_textures[texture_index];
@@ -644,15 +793,15 @@ void RasterizerVulkan::SyncTextureUnits(const Framebuffer* framebuffer) {
             case TextureType::ShadowCube: {
                 Surface& null_surface = res_cache.GetSurface(VideoCore::NULL_SURFACE_CUBE_ID);
                 const Sampler& null_sampler = res_cache.GetSampler(VideoCore::NULL_SURFACE_CUBE_ID);
-                update_queue.AddImageSampler(texture_set, texture_index, 0,
-                                             null_surface.ImageView(), null_sampler.Handle());
+                AddTextureDescriptor(texture_index, 0, null_surface.ImageView(),
+                                     null_sampler.Handle());
                 break;
             }
             default: {
                 Surface& null_surface = res_cache.GetSurface(VideoCore::NULL_SURFACE_ID);
                 const Sampler& null_sampler = res_cache.GetSampler(VideoCore::NULL_SURFACE_ID);
-                update_queue.AddImageSampler(texture_set, texture_index, 0,
-                                             null_surface.ImageView(), null_sampler.Handle());
+                AddTextureDescriptor(texture_index, 0, null_surface.ImageView(),
+                                     null_sampler.Handle());
                 break;
             }
             }
@@ -666,16 +815,15 @@ void RasterizerVulkan::SyncTextureUnits(const Framebuffer* framebuffer) {
                 Surface& surface = res_cache.GetTextureSurface(texture);
                 Sampler& sampler = res_cache.GetSampler(texture.config);
                 surface.flags |= VideoCore::SurfaceFlagBits::ShadowSource;
-                update_queue.AddImageSampler(texture_set, texture_index, 0, surface.StorageView(),
-                                             sampler.Handle());
+                AddTextureDescriptor(texture_index, 0, surface.StorageView(), sampler.Handle());
                 continue;
             }
             case TextureType::ShadowCube: {
-                BindShadowCube(texture, texture_set);
+                BindShadowCube(texture);
                 continue;
             }
             case TextureType::TextureCube: {
-                BindTextureCube(texture, texture_set);
+                BindTextureCube(texture);
                 continue;
             }
             default:
@@ -690,8 +838,29 @@ void RasterizerVulkan::SyncTextureUnits(const Framebuffer* framebuffer) {
         const bool is_feedback_loop = color_view == surface.FramebufferView();
         const vk::ImageView texture_view =
             is_feedback_loop ? surface.CopyImageView() : surface.ImageView();
-        update_queue.AddImageSampler(texture_set, texture_index, 0, texture_view, sampler.Handle());
+        AddTextureDescriptor(texture_index, 0, texture_view, sampler.Handle());
     }
+
+    // Draws sampling the same views reuse the set written earlier in the submission.
+    const auto [texture_set, needs_update] = pipeline_cache.Acquire(
+        DescriptorHeapType::Texture, {texture_descriptors.data(), texture_descriptors.size()});
+    if (!needs_update) {
+        return;
+    }
+    for (const TextureDescriptor& descriptor : texture_descriptors) {
+        update_queue.AddImageSampler(texture_set, descriptor.binding, descriptor.array_index,
+                                     descriptor.image_view, descriptor.sampler);
+    }
+}
+
+void RasterizerVulkan::AddTextureDescriptor(u32 binding, u32 array_index,
+                                            vk::ImageView image_view, vk::Sampler sampler) {
+    texture_descriptors.push_back({
+        .image_view = image_view,
+        .sampler = sampler,
+        .binding = binding,
+        .array_index = array_index,
+    });
 }
 
 void RasterizerVulkan::SyncUtilityTextures(const Framebuffer* framebuffer) {
@@ -700,12 +869,21 @@ void RasterizerVulkan::SyncUtilityTextures(const Framebuffer* framebuffer) {
         return;
     }
 
-    const auto utility_set = pipeline_cache.Acquire(DescriptorHeapType::Utility);
-    update_queue.AddStorageImage(utility_set, 0, framebuffer->ImageView(SurfaceType::Color));
+    const vk::ImageView shadow_view = framebuffer->ImageView(SurfaceType::Color);
+    const TextureDescriptor shadow_descriptor{
+        .image_view = shadow_view,
+        .sampler = {},
+        .binding = 0,
+        .array_index = 0,
+    };
+    const auto [utility_set, needs_update] =
+        pipeline_cache.Acquire(DescriptorHeapType::Utility, {&shadow_descriptor, 1});
+    if (needs_update) {
+        update_queue.AddStorageImage(utility_set, 0, shadow_view);
+    }
 }
 
-void RasterizerVulkan::BindShadowCube(const Pica::TexturingRegs::FullTextureConfig& texture,
-                                      vk::DescriptorSet texture_set) {
+void RasterizerVulkan::BindShadowCube(const Pica::TexturingRegs::FullTextureConfig& texture) {
     using CubeFace = Pica::TexturingRegs::CubeFace;
     auto info = Pica::Texture::TextureInfo::FromPicaRegister(texture.config, texture.format);
     constexpr std::array faces = {
@@ -722,13 +900,11 @@ void RasterizerVulkan::BindShadowCube(const Pica::TexturingRegs::FullTextureConf
         const VideoCore::SurfaceId surface_id = res_cache.GetTextureSurface(info);
         Surface& surface = res_cache.GetSurface(surface_id);
         surface.flags |= VideoCore::SurfaceFlagBits::ShadowSource;
-        update_queue.AddImageSampler(texture_set, 0, binding, surface.StorageView(),
-                                     sampler.Handle());
+        AddTextureDescriptor(0, binding, surface.StorageView(), sampler.Handle());
     }
 }
 
-void RasterizerVulkan::BindTextureCube(const Pica::TexturingRegs::FullTextureConfig& texture,
-                                       vk::DescriptorSet texture_set) {
+void RasterizerVulkan::BindTextureCube(const Pica::TexturingRegs::FullTextureConfig& texture) {
     using CubeFace = Pica::TexturingRegs::CubeFace;
     const VideoCore::TextureCubeConfig config = {
         .px = regs.texturing.GetCubePhysicalAddress(CubeFace::PositiveX),
@@ -744,7 +920,7 @@ void RasterizerVulkan::BindTextureCube(const Pica::TexturingRegs::FullTextureCon
 
     Surface& surface = res_cache.GetTextureCube(config);
     Sampler& sampler = res_cache.GetSampler(texture.config);
-    update_queue.AddImageSampler(texture_set, 0, 0, surface.ImageView(), sampler.Handle());
+    AddTextureDescriptor(0, 0, surface.ImageView(), sampler.Handle());
 }
 
 void RasterizerVulkan::FlushAll() {
@@ -757,14 +933,20 @@ void RasterizerVulkan::FlushRegion(PAddr addr, u32 size) {
 
 void RasterizerVulkan::InvalidateRegion(PAddr addr, u32 size) {
     res_cache.InvalidateRegion(addr, size);
+    vertex_cache.InvalidateRegion(addr, size);
+    index_cache.InvalidateRegion(addr, size);
 }
 
 void RasterizerVulkan::FlushAndInvalidateRegion(PAddr addr, u32 size) {
     res_cache.FlushRegion(addr, size);
     res_cache.InvalidateRegion(addr, size);
+    vertex_cache.InvalidateRegion(addr, size);
+    index_cache.InvalidateRegion(addr, size);
 }
 
 void RasterizerVulkan::ClearAll(bool flush) {
+    vertex_cache.Clear();
+    index_cache.Clear();
     res_cache.ClearAll(flush);
 }
 
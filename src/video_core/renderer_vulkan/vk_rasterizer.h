@@ -10,6 +10,7 @@
 #include "video_core/renderer_vulkan/vk_render_manager.h"
 #include "video_core/renderer_vulkan/vk_stream_buffer.h"
 #include "video_core/renderer_vulkan/vk_texture_runtime.h"
+#include "video_core/vertex_cache.h"
 
 namespace Frontend {
 class EmuWindow;
@@ -79,12 +80,14 @@ private:
     void SyncUtilityTextures(const Framebuffer* framebuffer);
 
     /// Binds the PICA shadow cube required for shadow mapping
-    void BindShadowCube(const Pica::TexturingRegs::FullTextureConfig& texture,
-                        vk::DescriptorSet texture_set);
+    void BindShadowCube(const Pica::TexturingRegs::FullTextureConfig& texture);
 
     /// Binds a texture cube to texture unit 0
-    void BindTextureCube(const Pica::TexturingRegs::FullTextureConfig& texture,
-                         vk::DescriptorSet texture_set);
+    void BindTextureCube(const Pica::TexturingRegs::FullTextureConfig& texture);
+
+    /// Adds an image descriptor to the texture set of the current draw
+    void AddTextureDescriptor(u32 binding, u32 array_index, vk::ImageView image_view,
+                              vk::Sampler sampler);
 
     /// Upload the uniform blocks to the uniform buffer object
     void UploadUniforms(bool accelerate_draw);
@@ -98,6 +101,9 @@ private:
     /// Setup index array for AccelerateDrawBatch
     void SetupIndexArray();
 
+    /// Drops the cached copies of vertex and index data overwritten by surface downloads
+    void InvalidateDownloadedVertexData();
+
     /// Setup vertex array for AccelerateDrawBatch
     void SetupVertexArray();
 
@@ -126,13 +132,28 @@ private:
     std::array<u32, 16> binding_offsets{};
     std::array<bool, 16> enable_attributes{};
     std::array<vk::Buffer, 16> vertex_buffers;
+    u16 cached_bindings{}; ///< Bitmask of the bindings sourced from vertex_cache_buffer
+    vk::Buffer index_buffer;
+    u32 index_offset{};
+    vk::IndexType index_type{};
     VertexArrayInfo vertex_info;
     PipelineInfo pipeline_info{};
 
+    /// Image descriptors of the texture set of the current draw
+    TextureDescriptors texture_descriptors;
+
     StreamBuffer stream_buffer;     ///< Vertex+Index buffer
     StreamBuffer uniform_buffer;    ///< Uniform buffer
     StreamBuffer texture_buffer;    ///< Texture buffer
     StreamBuffer texture_lf_buffer; ///< Texture Light-Fog buffer
+
+    StreamBuffer vertex_cache_buffer; ///< Vertex data kept across draws
+    StreamBuffer index_cache_buffer;  ///< Index data kept across draws
+    VideoCore::VertexCache vertex_cache;
+    VideoCore::VertexCache index_cache;
+    u64 vertex_cache_tick{}; ///< Last tick reading from vertex_cache_buffer
+    u64 index_cache_tick{};  ///< Last tick reading from index_cache_buffer
+
     vk::UniqueBufferView texture_lf_view;
     vk::UniqueBufferView texture_rg_view;
     vk::UniqueBufferView texture_rgba_view;
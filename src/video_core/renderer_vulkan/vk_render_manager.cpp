@@ -134,7 +134,11 @@ void RenderManager::EndRendering() {
     if (num_draws > MinDrawsToFlush && instance.ShouldFlush()) {
         scheduler.Flush();
         num_draws = 0;
+        return;
     }
+
+    // Render pass boundaries are where recording can move to another command buffer.
+    scheduler.SplitRecording();
 }
 
 vk::RenderPass RenderManager::GetRenderpass(VideoCore::PixelFormat color,
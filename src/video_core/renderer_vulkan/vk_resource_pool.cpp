@@ -6,9 +6,11 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cstddef>
 #include <optional>
 #include <unordered_map>
+#include "common/hash.h"
 #include "video_core/renderer_vulkan/vk_instance.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
 #include "video_core/renderer_vulkan/vk_resource_pool.h"
@@ -183,6 +185,33 @@ vk::DescriptorSet DescriptorHeap::Commit() {
     return descriptor_sets[index];
 }
 
+std::pair<vk::DescriptorSet, bool> DescriptorHeap::Commit(
+    std::span<const TextureDescriptor> descriptors) {
+    u64 hash = 0;
+    for (const TextureDescriptor& descriptor : descriptors) {
+        hash = Common::HashCombine(hash, Common::ComputeStructHash64(descriptor.image_view),
+                                   Common::ComputeStructHash64(descriptor.sampler),
+                                   descriptor.binding << 8 | descriptor.array_index);
+    }
+
+    // The hash only narrows the search, sets are reused when their contents match.
+    auto& bucket = cached_sets[hash];
+    const auto it = std::ranges::find_if(bucket, [descriptors](const CachedSet& cached) {
+        return std::equal(cached.descriptors.begin(), cached.descriptors.end(),
+                          descriptors.begin(), descriptors.end());
+    });
+    if (it != bucket.end()) {
+        return {it->descriptor_set, false};
+    }
+
+    const vk::DescriptorSet descriptor_set = Commit();
+    bucket.push_back({
+        .descriptors = TextureDescriptors(descriptors.begin(), descriptors.end()),
+        .descriptor_set = descriptor_set,
+    });
+    return {descriptor_set, true};
+}
+
 void DescriptorHeap::AppendDescriptorPool() {
     const vk::DescriptorPoolCreateInfo pool_info = {
         .flags = vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet,
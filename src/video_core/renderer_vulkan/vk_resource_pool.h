@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <span>
+#include <unordered_map>
+#include <utility>
 #include <vector>
+#include <boost/container/static_vector.hpp>
 #include "common/common_types.h"
 #include "video_core/renderer_vulkan/vk_common.h"
 
@@ -61,6 +65,19 @@ private:
     std::vector<vk::CommandBuffer> cmd_buffers;
 };
 
+/// Image view and sampler written to an element of a descriptor set binding.
+struct TextureDescriptor {
+    vk::ImageView image_view;
+    vk::Sampler sampler;
+    u32 binding;
+    u32 array_index;
+
+    bool operator==(const TextureDescriptor&) const = default;
+};
+
+/// Image descriptors of a descriptor set, up to a shadow cube and 2 texture units.
+using TextureDescriptors = boost::container::static_vector<TextureDescriptor, 8>;
+
 class DescriptorHeap final : public ResourcePool {
 public:
     explicit DescriptorHeap(const Instance& instance, MasterSemaphore* master_semaphore,
@@ -76,6 +93,19 @@ public:
 
     vk::DescriptorSet Commit();
 
+    /**
+     * Commits a descriptor set holding the given image descriptors. A set committed with the same
+     * descriptors since the last ResetCache is returned again, as its contents are already written.
+     * @returns The descriptor set and whether the caller has to write its contents.
+     */
+    std::pair<vk::DescriptorSet, bool> Commit(std::span<const TextureDescriptor> descriptors);
+
+    /// Forgets the sets committed by contents. Must be called when the scheduler submits, after
+    /// which the sets may be recycled and the resources they reference destroyed.
+    void ResetCache() {
+        cached_sets.clear();
+    }
+
 private:
     void AppendDescriptorPool();
 
@@ -86,6 +116,12 @@ private:
     std::vector<vk::DescriptorPoolSize> pool_sizes;
     std::vector<vk::UniqueDescriptorPool> pools;
     std::vector<vk::DescriptorSet> descriptor_sets;
+    struct CachedSet {
+        TextureDescriptors descriptors;
+        vk::DescriptorSet descriptor_set;
+    };
+    /// Sets committed by contents, bucketed by the hash of their descriptors.
+    std::unordered_map<u64, std::vector<CachedSet>> cached_sets;
 };
 
 } // namespace Vulkan
@@ -2,9 +2,13 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <mutex>
+#include <thread>
 #include <utility>
+#include "common/assert.h"
 #include "common/microprofile.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "video_core/renderer_vulkan/vk_instance.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -19,6 +23,22 @@ namespace Vulkan {
 
 namespace {
 
+/// Minimum number of commands for a segment to be recorded on a recording thread. Smaller segments
+/// cost more in command buffer overhead than they save in recording time.
+constexpr std::size_t MinSegmentCommands = 256;
+
+std::size_t NumRecordingThreads() {
+#ifdef HAVE_LIBRETRO
+    // The frontend submits a single command buffer per submission.
+    return 0;
+#else
+    if (!Settings::values.parallel_command_recording.GetValue()) {
+        return 0;
+    }
+    return std::clamp<std::size_t>(std::thread::hardware_concurrency() / 4, 1, 4);
+#endif
+}
+
 std::unique_ptr<MasterSemaphore> MakeMasterSemaphore(const Instance& instance) {
 #ifdef HAVE_LIBRETRO
     return CreateLibRetroMasterSemaphore(instance);
@@ -42,17 +62,26 @@ void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf) {
         command = next;
     }
     submit = false;
+    segment_end = false;
     command_offset = 0;
     first = nullptr;
     last = nullptr;
 }
 
 Scheduler::Scheduler(const Instance& instance)
-    : master_semaphore{MakeMasterSemaphore(instance)},
+    : instance{instance}, master_semaphore{MakeMasterSemaphore(instance)},
       command_pool{instance, master_semaphore.get()}, use_worker_thread{true} {
     AllocateWorkerCommandBuffers();
     if (use_worker_thread) {
         AcquireNewChunk();
+        if (const std::size_t num_threads = NumRecordingThreads(); num_threads > 0) {
+            recording_workers =
+                std::make_unique<Common::StatefulThreadWorker<std::unique_ptr<CommandPool>>>(
+                    num_threads, "VulkanRecorder", [this](std::size_t) {
+                        return std::make_unique<CommandPool>(this->instance,
+                                                             master_semaphore.get());
+                    });
+        }
         worker_thread = std::jthread([this](std::stop_token token) { WorkerThread(token); });
     }
 }
@@ -77,6 +106,11 @@ void Scheduler::WaitWorker() {
     }
 
     MICROPROFILE_SCOPE(Vulkan_WaitForWorker);
+
+    // Commands of an unfinished submission are only recorded once their segment ends.
+    if (recording_workers && submission_commands != 0) {
+        Flush();
+    }
     DispatchWork();
 
     // Ensure the queue is drained.
@@ -147,6 +181,11 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
             // to complete in the next step.
             std::exchange(lk, std::unique_lock{execution_mutex});
 
+            if (recording_workers) {
+                ProcessSegmentChunk(std::move(work));
+                continue;
+            }
+
             // Perform the work, tracking whether the chunk was a submission
             // before executing.
             const bool has_submit = work->HasSubmit();
@@ -189,6 +228,8 @@ void Scheduler::SubmitExecution(vk::Semaphore signal_semaphore, vk::Semaphore wa
     });
 
     master_semaphore->Refresh();
+    submission_commands = 0;
+    split_commands = 0;
 
     if (!use_worker_thread) {
         AllocateWorkerCommandBuffers();
@@ -198,6 +239,95 @@ void Scheduler::SubmitExecution(vk::Semaphore signal_semaphore, vk::Semaphore wa
     }
 }
 
+void Scheduler::SplitRecording() {
+    if (!recording_workers || submission_commands - split_commands < MinSegmentCommands) {
+        return;
+    }
+
+    // The next command buffer starts without any bound state.
+    state = StateFlags::AllDirty;
+    split_commands = submission_commands;
+    chunk->MarkSegmentEnd();
+    DispatchWork();
+}
+
+void Scheduler::ProcessSegmentChunk(std::unique_ptr<CommandChunk> work) {
+    const bool has_submit = work->HasSubmit();
+    const bool has_segment_end = work->HasSegmentEnd();
+    segment_chunks.push_back(std::move(work));
+
+    if (!has_submit) {
+        if (has_segment_end) {
+            recorded_segments.push_back(RecordSegment(std::move(segment_chunks)));
+            segment_chunks.clear();
+        }
+        return;
+    }
+
+    // The last segment ends with the submission command, so it is recorded here after the
+    // earlier segments have been submitted.
+    SubmitSegments();
+    for (const auto& segment_chunk : segment_chunks) {
+        segment_chunk->ExecuteAll(current_cmdbuf);
+    }
+    AllocateWorkerCommandBuffers();
+    RecycleChunks(segment_chunks);
+}
+
+std::future<vk::CommandBuffer> Scheduler::RecordSegment(
+    std::vector<std::unique_ptr<CommandChunk>>&& chunks) {
+    std::promise<vk::CommandBuffer> promise;
+    auto future = promise.get_future();
+    recording_workers->QueueWork([this, chunks = std::move(chunks), promise = std::move(promise)](
+                                     std::unique_ptr<CommandPool>* pool) mutable {
+        const vk::CommandBufferBeginInfo begin_info = {
+            .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+        };
+        const vk::CommandBuffer cmdbuf = (*pool)->Commit();
+        cmdbuf.begin(begin_info);
+        for (const auto& segment_chunk : chunks) {
+            segment_chunk->ExecuteAll(cmdbuf);
+        }
+        cmdbuf.end();
+        RecycleChunks(chunks);
+        promise.set_value(cmdbuf);
+    });
+    return future;
+}
+
+void Scheduler::SubmitSegments() {
+    if (recorded_segments.empty()) {
+        return;
+    }
+
+    segment_cmdbufs.clear();
+    for (auto& segment : recorded_segments) {
+        segment_cmdbufs.push_back(segment.get());
+    }
+    recorded_segments.clear();
+
+    // Signal operations of the following submission cover these command buffers too.
+    const vk::SubmitInfo submit_info = {
+        .commandBufferCount = static_cast<u32>(segment_cmdbufs.size()),
+        .pCommandBuffers = segment_cmdbufs.data(),
+    };
+
+    std::scoped_lock lock{submit_mutex};
+    try {
+        instance.GetGraphicsQueue().submit(submit_info);
+    } catch (vk::DeviceLostError& err) {
+        UNREACHABLE_MSG("Device lost during submit: {}", err.what());
+    }
+}
+
+void Scheduler::RecycleChunks(std::vector<std::unique_ptr<CommandChunk>>& chunks) {
+    std::scoped_lock rl{reserve_mutex};
+    for (auto& recycled_chunk : chunks) {
+        chunk_reserve.emplace_back(std::move(recycled_chunk));
+    }
+    chunks.clear();
+}
+
 void Scheduler::AcquireNewChunk() {
     std::scoped_lock lock{reserve_mutex};
     if (chunk_reserve.empty()) {
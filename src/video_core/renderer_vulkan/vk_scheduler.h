@@ -5,11 +5,13 @@
 #pragma once
 
 #include <functional>
+#include <future>
 #include <memory>
 #include <utility>
 #include "common/alignment.h"
 #include "common/common_funcs.h"
 #include "common/polyfill_thread.h"
+#include "common/thread_worker.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
 #include "video_core/renderer_vulkan/vk_resource_pool.h"
 
@@ -50,6 +52,7 @@ public:
     /// Records the command to the current chunk.
     template <typename T>
     void Record(T&& command) {
+        submission_commands++;
         if (chunk->Record(command)) {
             return;
         }
@@ -57,6 +60,11 @@ public:
         (void)chunk->Record(command);
     }
 
+    /// Marks a point outside of any render pass. With parallel recording enabled, the commands
+    /// recorded since the previous split are recorded into their own command buffer on a recording
+    /// thread, and are submitted before the commands that follow.
+    void SplitRecording();
+
     /// Marks the provided state as non dirty
     void MarkStateNonDirty(StateFlags flag) noexcept {
         state |= flag;
@@ -165,6 +173,10 @@ private:
             submit = true;
         }
 
+        void MarkSegmentEnd() {
+            segment_end = true;
+        }
+
         bool Empty() const {
             return recorded_counts == 0;
         }
@@ -173,6 +185,10 @@ private:
             return submit;
         }
 
+        bool HasSegmentEnd() const {
+            return segment_end;
+        }
+
     private:
         Command* first = nullptr;
         Command* last = nullptr;
@@ -180,6 +196,7 @@ private:
         std::size_t recorded_counts = 0;
         std::size_t command_offset = 0;
         bool submit = false;
+        bool segment_end = false;
         alignas(std::max_align_t) std::array<u8, 0x8000> data{};
     };
 
@@ -192,7 +209,21 @@ private:
 
     void AcquireNewChunk();
 
+    /// Handles a chunk on the worker thread when parallel recording is enabled.
+    void ProcessSegmentChunk(std::unique_ptr<CommandChunk> work);
+
+    /// Queues the chunks of a segment for recording into a command buffer of a recording thread.
+    std::future<vk::CommandBuffer> RecordSegment(
+        std::vector<std::unique_ptr<CommandChunk>>&& chunks);
+
+    /// Submits the segments recorded on the recording threads, in order.
+    void SubmitSegments();
+
+    /// Returns the chunks to the reserve.
+    void RecycleChunks(std::vector<std::unique_ptr<CommandChunk>>& chunks);
+
 private:
+    const Instance& instance;
     std::unique_ptr<MasterSemaphore> master_semaphore;
     CommandPool command_pool;
     std::unique_ptr<CommandChunk> chunk;
@@ -206,6 +237,12 @@ private:
     std::mutex reserve_mutex;
     std::mutex queue_mutex;
     std::condition_variable_any event_cv;
+    std::size_t submission_commands{}; ///< Commands recorded since the last submission
+    std::size_t split_commands{};      ///< Value of submission_commands at the last split
+    std::vector<std::unique_ptr<CommandChunk>> segment_chunks; ///< Chunks of the open segment
+    std::vector<std::future<vk::CommandBuffer>> recorded_segments;
+    std::vector<vk::CommandBuffer> segment_cmdbufs;
+    std::unique_ptr<Common::StatefulThreadWorker<std::unique_ptr<CommandPool>>> recording_workers;
     std::jthread worker_thread;
     bool use_worker_thread;
 };
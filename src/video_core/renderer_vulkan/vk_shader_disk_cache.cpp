@@ -73,9 +73,72 @@ void ShaderDiskCache::Init(const std::atomic_bool& stop_loading,
     if (!stop_loading && !InitGSCache(stop_loading, new_callback)) {
         RecreateCache(gs_cache, CacheFileType::GS_CACHE);
     }
+
+    // Shaders are regenerated on the workers. Pipelines keep pointers to the shaders, so the ones
+    // which failed are removed before any pipeline is created.
+    parent.shader_workers.WaitForRequests();
+    RemoveFailedShaders();
+
     if (!stop_loading && !InitPLCache(stop_loading, new_callback)) {
         RecreateCache(pl_cache, CacheFileType::PL_CACHE);
     }
+
+    // The regenerated files are complete, replace the old ones. Pipelines can keep building in
+    // the background.
+    for (auto& [type, regenerate_file] : regenerated_files) {
+        CacheFile& cache = type == CacheFileType::VS_CACHE   ? vs_cache
+                           : type == CacheFileType::FS_CACHE ? fs_cache
+                                                             : gs_cache;
+        const auto dir = parent.GetTransferableDir();
+        cache.SwitchMode(CacheFile::CacheOpMode::DELETE);
+        regenerate_file.reset();
+        FileUtil::Rename(GetCacheFile(dir, title_id, type, true),
+                         GetCacheFile(dir, title_id, type, false));
+        cache.SwitchMode(CacheFile::CacheOpMode::APPEND);
+    }
+    regenerated_files.clear();
+}
+
+void ShaderDiskCache::RemoveFailedShaders() {
+    for (const auto& [type, id] : failed_shaders) {
+        switch (type) {
+        case ProgramType::VS: {
+            const auto it = programmable_vertex_cache.find(id);
+            if (it == programmable_vertex_cache.end()) {
+                break;
+            }
+            std::erase_if(programmable_vertex_map, [shader = &it->second](const auto& config) {
+                return config.second == shader;
+            });
+            programmable_vertex_cache.erase(it);
+            break;
+        }
+        case ProgramType::FS:
+            fragment_shaders.erase(id);
+            break;
+        case ProgramType::GS:
+            fixed_geometry_shaders.erase(id);
+            break;
+        default:
+            UNREACHABLE();
+        }
+    }
+    failed_shaders.clear();
+}
+
+ShaderDiskCache::~ShaderDiskCache() {
+    // Queued shader and pipeline builds reference the objects owned by this cache.
+    parent.shader_workers.WaitForRequests();
+    parent.pipeline_workers.WaitForRequests();
+
+    if (!raw_fragment_configs.empty()) {
+        std::unordered_set<u64> canonical_configs;
+        for (const auto& [raw_hash, shader] : raw_fragment_configs) {
+            canonical_configs.insert(shader.first);
+        }
+        LOG_INFO(Render_Vulkan, "Fragment shader configs: {} raw, {} canonical",
+                 raw_fragment_configs.size(), canonical_configs.size());
+    }
 }
 
 std::optional<std::pair<u64, Shader* const>> ShaderDiskCache::UseProgrammableVertexShader(
@@ -101,7 +164,7 @@ std::optional<std::pair<u64, Shader* const>> ShaderDiskCache::UseProgrammableVer
 
         LOG_NEW_OBJECT(Render_Vulkan, "New VS config {:016X}", config_hash);
 
-        ExtraVSConfig extra_config = parent.CalcExtraConfig(config);
+        ExtraVSConfig extra_config = PipelineCache::CalcExtraConfig(config, parent.profile);
 
         auto program =
             Common::HashableString(GLSL::GenerateVertexShader(setup, config, extra_config));
@@ -124,7 +187,8 @@ std::optional<std::pair<u64, Shader* const>> ShaderDiskCache::UseProgrammableVer
             shader.program = std::move(program);
             const vk::Device device = parent.instance.GetDevice();
             parent.shader_workers.QueueWork([device, &shader, this, spirv_id] {
-                auto spirv = CompileGLSL(shader.program, vk::ShaderStageFlagBits::eVertex);
+                auto spirv = CompileGLSL(shader.program, vk::ShaderStageFlagBits::eVertex,
+                                         parent.profile.vk_disable_spirv_optimizer);
                 AppendVSSPIRV(vs_cache, spirv, spirv_id);
                 shader.program.clear();
                 shader.module = CompileSPV(spirv, device);
@@ -149,10 +213,18 @@ std::optional<std::pair<u64, Shader* const>> ShaderDiskCache::UseProgrammableVer
 std::optional<std::pair<u64, Shader* const>> ShaderDiskCache::UseFragmentShader(
     const Pica::RegsInternal& regs, const Pica::Shader::UserConfig& user) {
 
-    const FSConfig fs_config{regs};
+    FSConfig fs_config{regs};
+    const auto [raw_it, new_raw_config] = raw_fragment_configs.try_emplace(fs_config.Hash());
+    if (!new_raw_config) {
+        return raw_it->second;
+    }
+
+    // Configs that only differ in fields the generators ignore share the same shader
+    fs_config.Canonicalize();
     const auto fs_config_hash = fs_config.Hash();
     const auto [it, new_shader] = fragment_shaders.try_emplace(fs_config_hash, parent.instance);
     auto& shader = it->second;
+    raw_it->second = {fs_config_hash, &shader};
 
     if (new_shader) {
         LOG_NEW_OBJECT(Render_Vulkan, "New FS config {:016X}", fs_config_hash);
@@ -166,7 +238,8 @@ std::optional<std::pair<u64, Shader* const>> ShaderDiskCache::UseFragmentShader(
             } else {
                 const std::string code =
                     GLSL::GenerateFragmentShader(fs_config, user, parent.profile);
-                spirv = CompileGLSL(code, vk::ShaderStageFlagBits::eFragment);
+                spirv = CompileGLSL(code, vk::ShaderStageFlagBits::eFragment,
+                                    parent.profile.vk_disable_spirv_optimizer);
                 shader.module = CompileSPV(spirv, parent.instance.GetDevice());
             }
             shader.MarkDone();
@@ -184,6 +257,48 @@ std::optional<std::pair<u64, Shader* const>> ShaderDiskCache::UseFragmentShader(
     return std::make_pair(fs_config_hash, &shader);
 }
 
+std::pair<u64, Shader* const> ShaderDiskCache::UseUberFragmentShader(
+    const Pica::RegsInternal& regs, const Pica::Shader::UserConfig& user) {
+
+    FSConfig fs_config{regs};
+    fs_config.ClearUberTevState();
+    fs_config.Canonicalize();
+
+    Pica::Shader::UserConfig uber_user = user;
+    uber_user.use_uber_tev.Assign(1);
+
+    // Mix in the user config so uber shaders never share an ID with a specialised shader
+    const auto fs_config_hash = Common::HashCombine(fs_config.Hash(), uber_user.raw);
+    const auto [it, new_shader] =
+        uber_fragment_shaders.try_emplace(fs_config_hash, parent.instance);
+    auto& shader = it->second;
+
+    if (new_shader) {
+        LOG_NEW_OBJECT(Render_Vulkan, "New uber FS config {:016X}", fs_config_hash);
+
+        // The SPIR-V generator has no uber variant, always go through GLSL
+        parent.shader_workers.QueueWork([fs_config, uber_user, this, &shader, fs_config_hash]() {
+            const std::string code =
+                GLSL::GenerateFragmentShader(fs_config, uber_user, parent.profile);
+            const auto spirv = code.empty()
+                                   ? std::vector<u32>{}
+                                   : CompileGLSL(code, vk::ShaderStageFlagBits::eFragment,
+                                                 parent.profile.vk_disable_spirv_optimizer);
+            if (spirv.empty()) {
+                // Leave the module null, so that draws never pick the uber pipeline
+                LOG_ERROR(Render_Vulkan, "Failed to build uber fragment shader {:016X}",
+                          fs_config_hash);
+                shader.MarkDone();
+                return;
+            }
+            shader.module = CompileSPV(spirv, parent.instance.GetDevice());
+            shader.MarkDone();
+        });
+    }
+
+    return std::make_pair(fs_config_hash, &shader);
+}
+
 std::optional<std::pair<u64, Shader* const>> ShaderDiskCache::UseFixedGeometryShader(
     const Pica::RegsInternal& regs) {
 
@@ -218,7 +333,8 @@ std::optional<std::pair<u64, Shader* const>> ShaderDiskCache::UseFixedGeometrySh
                 extra.separable_shader = true;
 
                 const auto code = GLSL::GenerateFixedGeometryShader(gs_config, extra);
-                const auto spirv = CompileGLSL(code, vk::ShaderStageFlagBits::eGeometry);
+                const auto spirv = CompileGLSL(code, vk::ShaderStageFlagBits::eGeometry,
+                                               parent.profile.vk_disable_spirv_optimizer);
                 shader.module = CompileSPV(spirv, parent.instance.GetDevice());
                 shader.MarkDone();
 
@@ -255,7 +371,9 @@ GraphicsPipeline* ShaderDiskCache::GetPipeline(const PipelineInfo& info) {
             *parent.pipeline_layout, parent.current_shaders, &parent.pipeline_workers);
     }
 
-    if (known_graphic_pipelines.emplace(hash).second) {
+    // Pipelines using an uber shader can't be rebuilt from the disk cache
+    const bool is_uber = uber_fragment_shaders.contains(info.state.shader_ids[ProgramType::FS]);
+    if (!is_uber && known_graphic_pipelines.emplace(hash).second) {
         LOG_NEW_OBJECT(Render_Vulkan, "New Pipeline {:016X}", hash);
 
         PLConfigEntry entry{
@@ -431,23 +549,31 @@ bool ShaderDiskCache::CacheFile::SwitchMode(CacheOpMode mode) {
     switch (mode) {
     case CacheOpMode::READ: {
         next_entry_id = SIZE_MAX; // Force reading entries again
-        cached_file_data_start = 0;
         cached_file_data.clear();
         file = FileUtil::IOFile(filepath, "rb");
         bool is_open = file.IsGood();
         if (is_open) {
             GetTotalEntries();
+
+            // Load the whole file with a single read, entries are then decoded from memory.
+            cached_file_data.resize(file_size);
+            is_open = file.ReadAtBytes(cached_file_data.data(), file_size, 0) == file_size;
         }
         curr_mode = mode;
         return is_open;
     }
     case CacheOpMode::APPEND: {
-        if (!SwitchMode(CacheOpMode::READ)) {
-            curr_mode = mode;
-            return false;
+        if (curr_mode != CacheOpMode::READ) {
+            // Only the entry count is needed, there is no need to load the file.
+            next_entry_id = SIZE_MAX;
+            file = FileUtil::IOFile(filepath, "rb");
+            if (!file.IsGood()) {
+                curr_mode = mode;
+                return false;
+            }
+            GetTotalEntries();
         }
         file.Close();
-        cached_file_data_start = 0;
         cached_file_data.clear();
         curr_mode = mode;
         if (next_entry_id == SIZE_MAX) {
@@ -460,7 +586,6 @@ bool ShaderDiskCache::CacheFile::SwitchMode(CacheOpMode mode) {
     }
     case CacheOpMode::DELETE: {
         next_entry_id = SIZE_MAX;
-        cached_file_data_start = 0;
         cached_file_data.clear();
         file.Close();
         curr_mode = mode;
@@ -482,56 +607,60 @@ bool ShaderDiskCache::CacheFile::SwitchMode(CacheOpMode mode) {
 }
 
 bool ShaderDiskCache::CacheFile::ReadFromFileCached(void* dst, size_t position, size_t size) {
-    if (!dst || position + size > file_size) {
+    if (!dst || position > cached_file_data.size() || size > cached_file_data.size() - position) {
         return false;
     }
 
-    size_t offset = position - cached_file_data_start;
-    if (position < cached_file_data_start || offset > cached_file_data.size() ||
-        size > cached_file_data.size() - offset) {
-        if (size > CacheEntry::MAX_ENTRY_SIZE) {
-            return false;
-        }
-
-        size_t to_read = std::min<size_t>(CacheEntry::MAX_ENTRY_SIZE, file_size - position);
-
-        cached_file_data_start = position;
-        cached_file_data.resize(to_read);
-
-        if (file.ReadAtBytes(cached_file_data.data(), to_read, position) != to_read) {
-            return false;
-        }
+    std::memcpy(dst, cached_file_data.data() + position, size);
+    return true;
+}
 
-        offset = 0;
-    }
+std::string ShaderDiskCache::GetCacheFile(const std::string& dir, u64 title_id, CacheFileType type,
+                                          bool is_temp) {
+    const auto get_suffix = [](CacheFileType type) {
+        switch (type) {
+        case CacheFileType::VS_CACHE:
+            return "vs";
+        case CacheFileType::FS_CACHE:
+            return "fs";
+        case CacheFileType::GS_CACHE:
+            return "gs";
+        case CacheFileType::PL_CACHE:
+            return "pl";
+        default:
+            UNREACHABLE();
+            return "";
+        };
+    };
 
-    std::memcpy(dst, cached_file_data.data() + offset, size);
-    return true;
+    return dir + DIR_SEP + fmt::format("{:016X}_{}", title_id, get_suffix(type)) +
+           (is_temp ? "_temp" : "") + ".vkch";
 }
 
 std::string ShaderDiskCache::GetVSFile(u64 title_id, bool is_temp) const {
-    return parent.GetTransferableDir() + DIR_SEP + fmt::format("{:016X}_vs", title_id) +
-           (is_temp ? "_temp" : "") + ".vkch";
+    return GetCacheFile(parent.GetTransferableDir(), title_id, CacheFileType::VS_CACHE, is_temp);
 }
 
 std::string ShaderDiskCache::GetFSFile(u64 title_id, bool is_temp) const {
-    return parent.GetTransferableDir() + DIR_SEP + fmt::format("{:016X}_fs", title_id) +
-           (is_temp ? "_temp" : "") + ".vkch";
+    return GetCacheFile(parent.GetTransferableDir(), title_id, CacheFileType::FS_CACHE, is_temp);
 }
 
 std::string ShaderDiskCache::GetGSFile(u64 title_id, bool is_temp) const {
-    return parent.GetTransferableDir() + DIR_SEP + fmt::format("{:016X}_gs", title_id) +
-           (is_temp ? "_temp" : "") + ".vkch";
+    return GetCacheFile(parent.GetTransferableDir(), title_id, CacheFileType::GS_CACHE, is_temp);
 }
 
 std::string ShaderDiskCache::GetPLFile(u64 title_id, bool is_temp) const {
-    return parent.GetTransferableDir() + DIR_SEP + fmt::format("{:016X}_pl", title_id) +
-           (is_temp ? "_temp" : "") + ".vkch";
+    return GetCacheFile(parent.GetTransferableDir(), title_id, CacheFileType::PL_CACHE, is_temp);
 }
 
 bool ShaderDiskCache::RecreateCache(CacheFile& file, CacheFileType type) {
     file.SwitchMode(CacheFile::CacheOpMode::RECREATE);
+    AppendFileInfo(file, type, parent.profile);
+    return true;
+}
 
+void ShaderDiskCache::AppendFileInfo(CacheFile& file, CacheFileType type,
+                                     const Pica::Shader::Profile& profile) {
     std::array<char, 0x20> build_name{};
     size_t name_len = std::strlen(Common::g_build_fullname);
     memcpy(build_name.data(), Common::g_build_fullname, std::min(name_len, build_name.size()));
@@ -559,21 +688,540 @@ bool ShaderDiskCache::RecreateCache(CacheFile& file, CacheFileType type) {
         .file_type = type,
         .source_hash = GetSourceFileCacheVersionHash(),
         .build_name = build_name,
-        .profile = parent.profile,
+        .profile = profile,
     };
 
     file.Append(CacheEntryType::FILE_INFO, 0, entry, false);
+}
+
+std::optional<ShaderDiskCache::FileInfoEntry> ShaderDiskCache::ReadFileInfo(CacheFile& file,
+                                                                            CacheFileType type) {
+    if (!file.SwitchMode(CacheFile::CacheOpMode::READ)) {
+        return std::nullopt;
+    }
+
+    const auto curr = file.ReadFirst();
+    if (!curr.Valid() || curr.Type() != CacheEntryType::FILE_INFO) {
+        return std::nullopt;
+    }
+
+    const FileInfoEntry* file_info = curr.Payload<FileInfoEntry>();
+    if (!file_info || file_info->cache_magic != FileInfoEntry::CACHE_FILE_MAGIC ||
+        file_info->file_version != FileInfoEntry::CACHE_FILE_VERSION ||
+        file_info->file_type != type) {
+        return std::nullopt;
+    }
+
+    u64 struct_hash{};
+    switch (type) {
+    case CacheFileType::VS_CACHE:
+        struct_hash = PicaVSConfigState::StructHash();
+        break;
+    case CacheFileType::FS_CACHE:
+        struct_hash = FSConfig::StructHash();
+        break;
+    case CacheFileType::GS_CACHE:
+        struct_hash = PicaGSConfigState::StructHash();
+        break;
+    case CacheFileType::PL_CACHE:
+        struct_hash = StaticPipelineInfo::StructHash();
+        break;
+    default:
+        UNREACHABLE();
+    }
+
+    if (file_info->config_struct_hash != struct_hash) {
+        LOG_ERROR(Render_Vulkan, "Cache {} was created for a different config layout",
+                  static_cast<u32>(type));
+        return std::nullopt;
+    }
+
+    return *file_info;
+}
+
+bool ShaderDiskCache::BuildVSCacheOffline(const std::string& src_path, const std::string& dst_path,
+                                          Common::ThreadWorker& workers) {
+    // Work items reference the locals below, so they must be done before returning.
+    auto cleanup_on_error = [&]() { workers.WaitForRequests(); };
+
+    CacheFile src_file(src_path);
+    const auto file_info = ReadFileInfo(src_file, CacheFileType::VS_CACHE);
+    if (!file_info) {
+        MALFORMED_DISK_CACHE;
+    }
+    const Profile profile = file_info->profile;
+
+    CacheFile dst_file(dst_path);
+    if (!dst_file.SwitchMode(CacheFile::CacheOpMode::RECREATE)) {
+        return false;
+    }
+    AppendFileInfo(dst_file, CacheFileType::VS_CACHE, profile);
+
+    // Gather the configs and programs, the SPIRV entries are generated again.
+    std::vector<size_t> config_offsets;
+    std::unordered_map<u64, size_t> program_offsets;
+
+    const size_t tot_entries = src_file.GetTotalEntries();
+    auto curr = src_file.ReadFirst();
+    CacheEntry::CacheEntryHeader curr_header = curr.Header();
+    size_t curr_offset = curr.Position();
+
+    for (size_t i = 1; i < tot_entries; i++) {
+        std::tie(curr_offset, curr_header) = src_file.ReadNextHeader(curr_header, curr_offset);
+        if (!curr_header.Valid()) {
+            MALFORMED_DISK_CACHE;
+        }
+
+        if (curr_header.Type() == CacheEntryType::VS_CONFIG) {
+            config_offsets.push_back(curr_offset);
+        } else if (curr_header.Type() == CacheEntryType::VS_PROGRAM) {
+            program_offsets.try_emplace(curr_header.Id(), curr_offset);
+        } else if (curr_header.Type() != CacheEntryType::VS_SPIRV) {
+            MALFORMED_DISK_CACHE;
+        }
+    }
+
+    // Programs are shared by many configs, so keep the ones in use resident while the workers
+    // generate the shaders. Reading the source file is not thread safe.
+    std::unordered_map<u64, std::unique_ptr<VSProgramEntry>> programs;
+    std::unordered_set<u64> known_configs;
+
+    // Configs share SPIRV entries, and a config may only be written once the SPIRV it references
+    // has been. Configs which find their SPIRV still compiling are written by the compiling worker.
+    struct SPIRVState {
+        bool appended = false;
+        bool failed = false;
+        std::vector<std::pair<u64, std::shared_ptr<VSConfigEntry>>> waiting_configs;
+    };
+    std::unordered_map<u64, SPIRVState> spirv_states;
+    std::mutex spirv_mutex;
+    std::atomic<size_t> num_built = 0;
+
+    for (const size_t offset : config_offsets) {
+        curr = src_file.ReadAt(offset);
+        const VSConfigEntry* entry;
+
+        if (!curr.Valid() || curr.Type() != CacheEntryType::VS_CONFIG ||
+            !(entry = curr.Payload<VSConfigEntry>()) ||
+            entry->version != VSConfigEntry::EXPECTED_VERSION) {
+            MALFORMED_DISK_CACHE;
+        }
+
+        if (curr.Id() != entry->vs_config.Hash()) {
+            LOG_ERROR(Render_Vulkan, "Unexpected PicaVSConfig hash mismatch");
+            continue;
+        }
+        if (!known_configs.emplace(curr.Id()).second) {
+            continue;
+        }
+
+        auto [iter_program, new_program] = programs.try_emplace(entry->program_entry_id);
+        if (new_program) {
+            const auto program_it = program_offsets.find(entry->program_entry_id);
+            if (program_it == program_offsets.end()) {
+                LOG_ERROR(Render_Vulkan, "Missing program code for config entry");
+                programs.erase(iter_program);
+                continue;
+            }
+
+            const auto program_cache_entry = src_file.ReadAt(program_it->second);
+            const VSProgramEntry* program_entry;
+
+            if (!program_cache_entry.Valid() ||
+                program_cache_entry.Type() != CacheEntryType::VS_PROGRAM ||
+                !(program_entry = program_cache_entry.Payload<VSProgramEntry>()) ||
+                program_entry->version != VSProgramEntry::EXPECTED_VERSION) {
+                MALFORMED_DISK_CACHE;
+            }
+
+            iter_program->second = std::make_unique<VSProgramEntry>(*program_entry);
+            AppendVSProgram(dst_file, *program_entry, entry->program_entry_id);
+        }
+
+        const VSProgramEntry* program = iter_program->second.get();
+        if (!program) {
+            continue;
+        }
+
+        workers.QueueWork([&, program, config_id = curr.Id(),
+                           config_entry = std::make_shared<VSConfigEntry>(*entry)] {
+            auto shader_setup = std::make_unique<Pica::ShaderSetup>();
+            shader_setup->UpdateProgramCode(program->program_code, program->program_len);
+            shader_setup->UpdateSwizzleData(program->swizzle_code, program->swizzle_len);
+            shader_setup->DoProgramCodeFixup();
+
+            const auto& vs_config = config_entry->vs_config;
+            if (vs_config.state.program_hash != shader_setup->GetProgramCodeHash() ||
+                vs_config.state.swizzle_hash != shader_setup->GetSwizzleDataHash()) {
+                LOG_ERROR(Render_Vulkan, "Unexpected ShaderSetup hash mismatch");
+                return;
+            }
+
+            const ExtraVSConfig extra_config = PipelineCache::CalcExtraConfig(vs_config, profile);
+            auto program_glsl = Common::HashableString(
+                GLSL::GenerateVertexShader(*shader_setup, vs_config, extra_config));
+            if (program_glsl.empty()) {
+                LOG_ERROR(Render_Vulkan, "Failed to retrieve programmable vertex shader");
+                return;
+            }
+
+            const u64 spirv_id = program_glsl.Hash();
+            config_entry->spirv_entry_id = spirv_id;
+            {
+                std::scoped_lock lock{spirv_mutex};
+                auto [it, new_spirv] = spirv_states.try_emplace(spirv_id);
+                if (!new_spirv) {
+                    if (it->second.appended) {
+                        AppendVSConfig(dst_file, *config_entry, config_id);
+                    } else if (!it->second.failed) {
+                        it->second.waiting_configs.emplace_back(config_id, config_entry);
+                    }
+                    return;
+                }
+            }
+
+            const auto spirv = CompileGLSL(program_glsl, vk::ShaderStageFlagBits::eVertex,
+                                           profile.vk_disable_spirv_optimizer);
+            if (!spirv.empty()) {
+                AppendVSSPIRV(dst_file, spirv, spirv_id);
+                ++num_built;
+            }
+
+            std::vector<std::pair<u64, std::shared_ptr<VSConfigEntry>>> waiting_configs;
+            {
+                std::scoped_lock lock{spirv_mutex};
+                SPIRVState& state = spirv_states[spirv_id];
+                waiting_configs = std::move(state.waiting_configs);
+                state.appended = !spirv.empty();
+                state.failed = spirv.empty();
+            }
+
+            if (spirv.empty()) {
+                LOG_ERROR(Render_Vulkan, "Failed to compile programmable vertex shader");
+                return;
+            }
+            AppendVSConfig(dst_file, *config_entry, config_id);
+            for (const auto& [waiting_id, waiting_entry] : waiting_configs) {
+                AppendVSConfig(dst_file, *waiting_entry, waiting_id);
+            }
+        });
+    }
+
+    workers.WaitForRequests();
+
+    LOG_INFO(Render_Vulkan, "Built {} vertex shaders from {} configs", num_built.load(),
+             known_configs.size());
+    return true;
+}
+
+bool ShaderDiskCache::BuildFSCacheOffline(const std::string& src_path, const std::string& dst_path,
+                                          Common::ThreadWorker& workers) {
+    // Work items reference the locals below, so they must be done before returning.
+    auto cleanup_on_error = [&]() { workers.WaitForRequests(); };
+
+    CacheFile src_file(src_path);
+    const auto file_info = ReadFileInfo(src_file, CacheFileType::FS_CACHE);
+    if (!file_info) {
+        MALFORMED_DISK_CACHE;
+    }
+    const Profile profile = file_info->profile;
+
+    CacheFile dst_file(dst_path);
+    if (!dst_file.SwitchMode(CacheFile::CacheOpMode::RECREATE)) {
+        return false;
+    }
+    AppendFileInfo(dst_file, CacheFileType::FS_CACHE, profile);
+
+    std::unordered_set<u64> known_configs;
+    std::atomic<size_t> num_built = 0;
+
+    const size_t tot_entries = src_file.GetTotalEntries();
+    auto curr = src_file.ReadFirst();
+    CacheEntry::CacheEntryHeader curr_header = curr.Header();
+    size_t curr_offset = curr.Position();
+
+    for (size_t i = 1; i < tot_entries; i++) {
+        std::tie(curr_offset, curr_header) = src_file.ReadNextHeader(curr_header, curr_offset);
+        if (!curr_header.Valid()) {
+            MALFORMED_DISK_CACHE;
+        }
+
+        if (curr_header.Type() == CacheEntryType::FS_SPIRV) {
+            continue;
+        }
+
+        curr = src_file.ReadAt(curr_offset);
+        const FSConfigEntry* entry;
+
+        if (!curr.Valid() || curr.Type() != CacheEntryType::FS_CONFIG ||
+            !(entry = curr.Payload<FSConfigEntry>()) ||
+            entry->version != FSConfigEntry::EXPECTED_VERSION) {
+            MALFORMED_DISK_CACHE;
+        }
+
+        const auto fs_config_hash = entry->fs_config.Hash();
+        if (curr.Id() != fs_config_hash) {
+            LOG_ERROR(Render_Vulkan, "Unexpected FSConfig hash mismatch");
+            continue;
+        }
+        if (!known_configs.emplace(fs_config_hash).second) {
+            continue;
+        }
+
+        workers.QueueWork([&, fs_config_hash,
+                           config_entry = std::make_shared<FSConfigEntry>(*entry)] {
+            const auto& fs_config = config_entry->fs_config;
+
+            std::vector<u32> spirv;
+            if (profile.vk_use_spirv_generator && !fs_config.UsesSpirvIncompatibleConfig()) {
+                spirv = SPIRV::GenerateFragmentShader(fs_config, profile);
+            } else {
+                UserConfig user{};
+                const std::string code_glsl =
+                    GLSL::GenerateFragmentShader(fs_config, user, profile);
+                if (code_glsl.empty()) {
+                    LOG_ERROR(Render_Vulkan, "Failed to retrieve fragment shader");
+                    return;
+                }
+                spirv = CompileGLSL(code_glsl, vk::ShaderStageFlagBits::eFragment,
+                                    profile.vk_disable_spirv_optimizer);
+            }
+
+            if (spirv.empty()) {
+                LOG_ERROR(Render_Vulkan, "Failed to compile fragment shader");
+                return;
+            }
+
+            AppendFSSPIRV(dst_file, spirv, fs_config_hash);
+            AppendFSConfig(dst_file, *config_entry, fs_config_hash);
+            ++num_built;
+        });
+    }
+
+    workers.WaitForRequests();
+
+    LOG_INFO(Render_Vulkan, "Built {} of {} fragment shaders", num_built.load(),
+             known_configs.size());
+    return true;
+}
+
+bool ShaderDiskCache::BuildGSCacheOffline(const std::string& src_path, const std::string& dst_path,
+                                          Common::ThreadWorker& workers) {
+    // Work items reference the locals below, so they must be done before returning.
+    auto cleanup_on_error = [&]() { workers.WaitForRequests(); };
+
+    CacheFile src_file(src_path);
+    const auto file_info = ReadFileInfo(src_file, CacheFileType::GS_CACHE);
+    if (!file_info) {
+        MALFORMED_DISK_CACHE;
+    }
+    const Profile profile = file_info->profile;
+
+    CacheFile dst_file(dst_path);
+    if (!dst_file.SwitchMode(CacheFile::CacheOpMode::RECREATE)) {
+        return false;
+    }
+    AppendFileInfo(dst_file, CacheFileType::GS_CACHE, profile);
+
+    // Devices without geometry shader support, or with barycentrics, only keep the known configs.
+    const bool geo_shaders_needed =
+        profile.has_geometry_shader && !profile.has_fragment_shader_barycentric;
+
+    std::unordered_set<u64> known_configs;
+    std::atomic<size_t> num_built = 0;
+
+    const size_t tot_entries = src_file.GetTotalEntries();
+    auto curr = src_file.ReadFirst();
+    CacheEntry::CacheEntryHeader curr_header = curr.Header();
+    size_t curr_offset = curr.Position();
+
+    for (size_t i = 1; i < tot_entries; i++) {
+        std::tie(curr_offset, curr_header) = src_file.ReadNextHeader(curr_header, curr_offset);
+        if (!curr_header.Valid()) {
+            MALFORMED_DISK_CACHE;
+        }
+
+        if (curr_header.Type() == CacheEntryType::GS_SPIRV) {
+            continue;
+        }
+
+        curr = src_file.ReadAt(curr_offset);
+        const GSConfigEntry* entry;
+
+        if (!curr.Valid() || curr.Type() != CacheEntryType::GS_CONFIG ||
+            !(entry = curr.Payload<GSConfigEntry>()) ||
+            entry->version != GSConfigEntry::EXPECTED_VERSION) {
+            MALFORMED_DISK_CACHE;
+        }
+
+        const auto gs_config_hash = entry->gs_config.Hash();
+        if (curr.Id() != gs_config_hash) {
+            LOG_ERROR(Render_Vulkan, "Unexpected PicaGSConfigState hash mismatch");
+            continue;
+        }
+        if (!known_configs.emplace(gs_config_hash).second) {
+            continue;
+        }
+
+        if (!geo_shaders_needed) {
+            AppendGSConfig(dst_file, *entry, gs_config_hash);
+            continue;
+        }
+
+        workers.QueueWork([&, gs_config_hash,
+                           config_entry = std::make_shared<GSConfigEntry>(*entry)] {
+            ExtraFixedGSConfig extra;
+            extra.use_clip_planes = profile.has_clip_planes;
+            extra.separable_shader = true;
+
+            const auto code_glsl =
+                GLSL::GenerateFixedGeometryShader(config_entry->gs_config, extra);
+            if (code_glsl.empty()) {
+                LOG_ERROR(Render_Vulkan, "Failed to retrieve fixed geometry shader");
+                return;
+            }
+
+            const auto spirv = CompileGLSL(code_glsl, vk::ShaderStageFlagBits::eGeometry,
+                                           profile.vk_disable_spirv_optimizer);
+            if (spirv.empty()) {
+                LOG_ERROR(Render_Vulkan, "Failed to compile fixed geometry shader");
+                return;
+            }
+
+            AppendGSSPIRV(dst_file, spirv, gs_config_hash);
+            AppendGSConfig(dst_file, *config_entry, gs_config_hash);
+            ++num_built;
+        });
+    }
+
+    workers.WaitForRequests();
+
+    LOG_INFO(Render_Vulkan, "Built {} of {} geometry shaders", num_built.load(),
+             known_configs.size());
     return true;
 }
 
+bool ShaderDiskCache::BuildTransferableCache(u64 title_id, const std::string& src_dir,
+                                             const std::string& dst_dir,
+                                             std::size_t num_threads) {
+    LOG_INFO(Render_Vulkan, "Building transferable shader cache for title {:016X}", title_id);
+
+    if (!FileUtil::CreateFullPath(dst_dir + DIR_SEP)) {
+        LOG_ERROR(Render_Vulkan, "Failed to create directory {}", dst_dir);
+        return false;
+    }
+
+    // The workers must outlive the builders, which wait for them before returning.
+    Common::ThreadWorker workers{std::max<std::size_t>(num_threads, 1), "Shader Cache Builder"};
+
+    using BuildFunc = bool (*)(const std::string&, const std::string&, Common::ThreadWorker&);
+    constexpr std::array<std::pair<CacheFileType, BuildFunc>, 3> builders{{
+        {CacheFileType::VS_CACHE, &BuildVSCacheOffline},
+        {CacheFileType::FS_CACHE, &BuildFSCacheOffline},
+        {CacheFileType::GS_CACHE, &BuildGSCacheOffline},
+    }};
+
+    bool found = false;
+    bool success = true;
+    for (const auto& [type, build] : builders) {
+        const auto src_path = GetCacheFile(src_dir, title_id, type, false);
+        if (!FileUtil::Exists(src_path)) {
+            continue;
+        }
+        found = true;
+
+        // Build into a temporary file, as the source and destination may be the same file.
+        const auto dst_path = GetCacheFile(dst_dir, title_id, type, false);
+        const auto temp_path = GetCacheFile(dst_dir, title_id, type, true);
+        if (!build(src_path, temp_path, workers)) {
+            LOG_ERROR(Render_Vulkan, "Failed to build {}", src_path);
+            FileUtil::Delete(temp_path);
+            success = false;
+            continue;
+        }
+
+        FileUtil::Delete(dst_path);
+        FileUtil::Rename(temp_path, dst_path);
+    }
+
+    // Pipelines are compiled by the driver, so their configs are carried over as they are.
+    const auto src_pl_path = GetCacheFile(src_dir, title_id, CacheFileType::PL_CACHE, false);
+    const auto dst_pl_path = GetCacheFile(dst_dir, title_id, CacheFileType::PL_CACHE, false);
+    if (FileUtil::Exists(src_pl_path) && src_pl_path != dst_pl_path) {
+        found = true;
+        success &= FileUtil::Copy(src_pl_path, dst_pl_path);
+    }
+
+    if (!found) {
+        LOG_ERROR(Render_Vulkan, "No shader cache found for title {:016X} in {}", title_id,
+                  src_dir);
+    }
+    return found && success;
+}
+
+template <typename Map>
+void ShaderDiskCache::CompileCachedSPIRV(CacheFile& file,
+                                         std::span<const std::pair<u64, size_t>> entries,
+                                         Map& shaders) {
+    std::vector<std::pair<Shader*, size_t>> pending;
+    for (const auto& [id, offset] : entries) {
+        auto [it, new_shader] = shaders.try_emplace(id, parent.instance);
+        if (new_shader) {
+            pending.emplace_back(&it->second, offset);
+        }
+    }
+
+    // Entries are decompressed and turned into modules in batches, as a single one is too little
+    // work to be worth queueing.
+    constexpr size_t BatchSize = 32;
+    const size_t num_batches = (pending.size() + BatchSize - 1) / BatchSize;
+    std::atomic<size_t> remaining_batches = num_batches;
+    Common::AsyncHandle batches_done;
+
+    for (size_t begin = 0; begin < pending.size(); begin += BatchSize) {
+        const std::span batch{pending.data() + begin, std::min(BatchSize, pending.size() - begin)};
+        parent.shader_workers.QueueWork([this, &file, batch, &remaining_batches, &batches_done] {
+            for (const auto& [shader, offset] : batch) {
+                const auto entry = file.ReadAt(offset);
+                if (entry.Valid()) {
+                    const auto spirv =
+                        std::span<const u32>(reinterpret_cast<const u32*>(entry.Data().data()),
+                                             entry.Data().size() / sizeof(u32));
+                    shader->module = CompileSPV(spirv, parent.instance.GetDevice());
+                }
+                shader->MarkDone();
+            }
+            if (--remaining_batches == 0) {
+                batches_done.MarkDone();
+            }
+        });
+    }
+
+    if (num_batches != 0) {
+        batches_done.WaitDone();
+    }
+
+    std::erase_if(shaders, [](const auto& pair) {
+        if (!pair.second.Handle()) {
+            // Compilation failed for some reason, remove from cache to let it
+            // be regenerated at runtime or during config processing.
+            LOG_ERROR(Render_Vulkan, "Unexpected program compilation failure");
+            return true;
+        }
+        return false;
+    });
+}
+
 bool ShaderDiskCache::InitVSCache(const std::atomic_bool& stop_loading,
                                   const VideoCore::DiskResourceLoadCallback& callback) {
     std::vector<size_t> pending_configs;
     std::unordered_map<u64, size_t> pending_programs;
+    std::vector<std::pair<u64, size_t>> pending_spirv;
     std::unique_ptr<Pica::ShaderSetup> shader_setup;
     std::unique_ptr<CacheFile> regenerate_file;
 
     auto cleanup_on_error = [&]() {
+        parent.shader_workers.WaitForRequests();
         programmable_vertex_cache.clear();
         programmable_vertex_map.clear();
         known_vertex_programs.clear();
@@ -668,34 +1316,7 @@ bool ShaderDiskCache::InitVSCache(const std::atomic_bool& stop_loading,
             // user settings do not match, which could lead to different SPIRV.
             // These will be re-created from the cached config and programs later.
             if (!regenerate_file) {
-                LOG_DEBUG(Render_Vulkan, "    processing SPIRV.");
-
-                curr = vs_cache.ReadAt(curr_offset);
-                if (!curr.Valid() || curr.Type() != CacheEntryType::VS_SPIRV) {
-                    MALFORMED_DISK_CACHE;
-                }
-
-                const u8* spirv_data = curr.Data().data();
-                const size_t spirv_size = curr.Data().size();
-
-                auto [iter_prog, new_program] =
-                    programmable_vertex_cache.try_emplace(curr.Id(), parent.instance);
-                if (new_program) {
-                    LOG_DEBUG(Render_Vulkan, "    compiling SPIRV.");
-
-                    const auto spirv = std::span<const u32>(
-                        reinterpret_cast<const u32*>(spirv_data), spirv_size / sizeof(u32));
-
-                    iter_prog->second.module = CompileSPV(spirv, parent.instance.GetDevice());
-                    iter_prog->second.MarkDone();
-
-                    if (!iter_prog->second.module) {
-                        // Compilation failed for some reason, remove from cache to let it
-                        // be re-generated at runtime or during config and program processing.
-                        LOG_ERROR(Render_Vulkan, "Unexpected program compilation failure");
-                        programmable_vertex_cache.erase(iter_prog);
-                    }
-                }
+                pending_spirv.push_back({curr_header.Id(), curr_offset});
             }
 
             if (callback) {
@@ -707,6 +1328,10 @@ bool ShaderDiskCache::InitVSCache(const std::atomic_bool& stop_loading,
         }
     }
 
+    // Failed modules are dropped, so that they get re-generated during config and program
+    // processing.
+    CompileCachedSPIRV(vs_cache, pending_spirv, programmable_vertex_cache);
+
     // Once we have all the shader instances created from SPIRV, we can link them to the VS configs.
     LOG_DEBUG(Render_Vulkan, "Linking with config entries.");
 
@@ -821,7 +1446,8 @@ bool ShaderDiskCache::InitVSCache(const std::atomic_bool& stop_loading,
                     continue;
                 }
 
-                ExtraVSConfig extra_config = parent.CalcExtraConfig(entry->vs_config);
+                ExtraVSConfig extra_config =
+                    PipelineCache::CalcExtraConfig(entry->vs_config, parent.profile);
 
                 auto program_glsl = Common::HashableString(
                     GLSL::GenerateVertexShader(*shader_setup, entry->vs_config, extra_config));
@@ -841,15 +1467,31 @@ bool ShaderDiskCache::InitVSCache(const std::atomic_bool& stop_loading,
                 if (new_spirv) {
                     LOG_DEBUG(Render_Vulkan, "    compiling SPIRV.");
 
-                    auto spirv = CompileGLSL(program_glsl, vk::ShaderStageFlagBits::eVertex);
-
-                    iter_prog->second.module = CompileSPV(spirv, parent.instance.GetDevice());
-                    iter_prog->second.MarkDone();
-
-                    if (regenerate_file) {
-                        // If we are regenerating, save the new spirv to disk.
-                        AppendVSSPIRV(*regenerate_file, spirv, spirv_id);
-                    }
+                    auto& shader = iter_prog->second;
+                    shader.program = std::move(program_glsl);
+                    CacheFile* spirv_file = regenerate_file.get();
+                    parent.shader_workers.QueueWork([this, &shader, spirv_file, spirv_id] {
+                        const auto spirv =
+                            CompileGLSL(shader.program, vk::ShaderStageFlagBits::eVertex,
+                                        parent.profile.vk_disable_spirv_optimizer);
+                        shader.program.clear();
+                        if (spirv.empty()) {
+                            LOG_ERROR(Render_Vulkan,
+                                      "Failed to regenerate programmable vertex shader {:016X}",
+                                      spirv_id);
+                            shader.MarkDone();
+                            std::scoped_lock lock{failed_shaders_mutex};
+                            failed_shaders.emplace_back(ProgramType::VS, spirv_id);
+                            return;
+                        }
+                        shader.module = CompileSPV(spirv, parent.instance.GetDevice());
+                        shader.MarkDone();
+
+                        if (spirv_file) {
+                            // If we are regenerating, save the new spirv to disk.
+                            AppendVSSPIRV(*spirv_file, spirv, spirv_id);
+                        }
+                    });
                 }
 
                 if (regenerate_file) {
@@ -871,10 +1513,10 @@ bool ShaderDiskCache::InitVSCache(const std::atomic_bool& stop_loading,
     }
 
     if (regenerate_file) {
-        // If we are regenerating, replace the old file with the new one.
-        vs_cache.SwitchMode(CacheFile::CacheOpMode::DELETE);
-        regenerate_file.reset();
-        FileUtil::Rename(GetVSFile(title_id, true), GetVSFile(title_id, false));
+        // The workers are still writing to the new file, it replaces the old one once they are
+        // done.
+        regenerated_files.emplace_back(CacheFileType::VS_CACHE, std::move(regenerate_file));
+        return true;
     }
 
     // Switch to append mode to receive new entries.
@@ -884,9 +1526,11 @@ bool ShaderDiskCache::InitVSCache(const std::atomic_bool& stop_loading,
 bool ShaderDiskCache::InitFSCache(const std::atomic_bool& stop_loading,
                                   const VideoCore::DiskResourceLoadCallback& callback) {
     std::vector<std::pair<u64, size_t>> pending_configs;
+    std::vector<std::pair<u64, size_t>> pending_spirv;
     std::unique_ptr<CacheFile> regenerate_file;
 
     auto cleanup_on_error = [&]() {
+        parent.shader_workers.WaitForRequests();
         fragment_shaders.clear();
         if (regenerate_file) {
             regenerate_file->SwitchMode(CacheFile::CacheOpMode::DELETE);
@@ -969,34 +1613,7 @@ bool ShaderDiskCache::InitFSCache(const std::atomic_bool& stop_loading,
             // user settings do not match, which could lead to different SPIRV.
             // These will be regenerated from the cached config later.
             if (!regenerate_file) {
-                LOG_DEBUG(Render_Vulkan, "    processing SPIRV.");
-
-                curr = fs_cache.ReadAt(curr_offset);
-                if (!curr.Valid() || curr.Type() != CacheEntryType::FS_SPIRV) {
-                    MALFORMED_DISK_CACHE;
-                }
-
-                const u8* spirv_data = curr.Data().data();
-                const size_t spirv_size = curr.Data().size();
-
-                auto [iter_spirv, new_program] =
-                    fragment_shaders.try_emplace(curr.Id(), parent.instance);
-                if (new_program) {
-                    LOG_DEBUG(Render_Vulkan, "    compiling SPIRV.");
-
-                    const auto spirv = std::span<const u32>(
-                        reinterpret_cast<const u32*>(spirv_data), spirv_size / sizeof(u32));
-
-                    iter_spirv->second.module = CompileSPV(spirv, parent.instance.GetDevice());
-                    iter_spirv->second.MarkDone();
-
-                    if (!iter_spirv->second.module) {
-                        // Compilation failed for some reason, remove from cache to let it
-                        // be regenerated at runtime or during config processing.
-                        LOG_ERROR(Render_Vulkan, "Unexpected program compilation failure");
-                        fragment_shaders.erase(iter_spirv);
-                    }
-                }
+                pending_spirv.push_back({curr_header.Id(), curr_offset});
             }
 
             if (callback) {
@@ -1008,6 +1625,9 @@ bool ShaderDiskCache::InitFSCache(const std::atomic_bool& stop_loading,
         }
     }
 
+    // Failed modules are dropped, so that they get regenerated during config processing.
+    CompileCachedSPIRV(fs_cache, pending_spirv, fragment_shaders);
+
     // Once we have all the shader instances created from SPIRV, we can link them to the FS configs.
     LOG_DEBUG(Render_Vulkan, "Linking with config entries.");
 
@@ -1053,45 +1673,59 @@ bool ShaderDiskCache::InitFSCache(const std::atomic_bool& stop_loading,
         const auto [it, new_shader] = fragment_shaders.try_emplace(fs_config_hash, parent.instance);
         auto& shader = it->second;
 
-        std::vector<u32> spirv;
-        if (parent.profile.vk_use_spirv_generator &&
-            !entry->fs_config.UsesSpirvIncompatibleConfig()) {
-            // Use SPIRV generator directly
+        CacheFile* spirv_file = regenerate_file.get();
+        parent.shader_workers.QueueWork([this, &shader, spirv_file, fs_config_hash,
+                                         config_entry = *entry] {
+            const auto& fs_config = config_entry.fs_config;
 
-            spirv = SPIRV::GenerateFragmentShader(entry->fs_config, parent.profile);
-            shader.module = CompileSPV(spirv, parent.instance.GetDevice());
-        } else {
-            // Use GLSL generator then convert to SPIRV
+            std::vector<u32> spirv;
+            if (parent.profile.vk_use_spirv_generator &&
+                !fs_config.UsesSpirvIncompatibleConfig()) {
+                // Use SPIRV generator directly
 
-            UserConfig user{};
-            const std::string code_glsl =
-                GLSL::GenerateFragmentShader(entry->fs_config, user, parent.profile);
+                spirv = SPIRV::GenerateFragmentShader(fs_config, parent.profile);
+            } else {
+                // Use GLSL generator then convert to SPIRV
 
-            if (code_glsl.empty()) {
-                LOG_ERROR(Render_Vulkan, "Failed to retrieve programmable vertex shader");
-                fragment_shaders.erase(it);
-                continue;
+                UserConfig user{};
+                const std::string code_glsl =
+                    GLSL::GenerateFragmentShader(fs_config, user, parent.profile);
+                if (code_glsl.empty()) {
+                    LOG_ERROR(Render_Vulkan, "Failed to retrieve fragment shader");
+                } else {
+                    spirv = CompileGLSL(code_glsl, vk::ShaderStageFlagBits::eFragment,
+                                        parent.profile.vk_disable_spirv_optimizer);
+                }
             }
 
-            spirv = CompileGLSL(code_glsl, vk::ShaderStageFlagBits::eFragment);
+            if (spirv.empty()) {
+                // The map cannot be modified from the workers, the entry is removed once they are
+                // done.
+                LOG_ERROR(Render_Vulkan, "Failed to regenerate fragment shader {:016X}",
+                          fs_config_hash);
+                shader.MarkDone();
+                std::scoped_lock lock{failed_shaders_mutex};
+                failed_shaders.emplace_back(ProgramType::FS, fs_config_hash);
+                return;
+            }
             shader.module = CompileSPV(spirv, parent.instance.GetDevice());
-        }
-        shader.MarkDone();
+            shader.MarkDone();
 
-        if (regenerate_file) {
-            // Append the config and SPIRV to the new file.
-            AppendFSSPIRV(*regenerate_file, spirv, fs_config_hash);
-            AppendFSConfig(*regenerate_file, *entry, fs_config_hash);
-        }
+            if (spirv_file) {
+                // Append the config and SPIRV to the new file.
+                AppendFSSPIRV(*spirv_file, spirv, fs_config_hash);
+                AppendFSConfig(*spirv_file, config_entry, fs_config_hash);
+            }
+        });
 
         LOG_DEBUG(Render_Vulkan, "    linked with new SPIRV.");
     }
 
     if (regenerate_file) {
-        // If we are regenerating, replace the old file with the new one.
-        fs_cache.SwitchMode(CacheFile::CacheOpMode::DELETE);
-        regenerate_file.reset();
-        FileUtil::Rename(GetFSFile(title_id, true), GetFSFile(title_id, false));
+        // The workers are still writing to the new file, it replaces the old one once they are
+        // done.
+        regenerated_files.emplace_back(CacheFileType::FS_CACHE, std::move(regenerate_file));
+        return true;
     }
 
     // Switch to append mode to receive new entries.
@@ -1101,9 +1735,11 @@ bool ShaderDiskCache::InitFSCache(const std::atomic_bool& stop_loading,
 bool ShaderDiskCache::InitGSCache(const std::atomic_bool& stop_loading,
                                   const VideoCore::DiskResourceLoadCallback& callback) {
     std::vector<std::pair<u64, size_t>> pending_configs;
+    std::vector<std::pair<u64, size_t>> pending_spirv;
     std::unique_ptr<CacheFile> regenerate_file;
 
     auto cleanup_on_error = [&]() {
+        parent.shader_workers.WaitForRequests();
         fixed_geometry_shaders.clear();
         if (regenerate_file) {
             regenerate_file->SwitchMode(CacheFile::CacheOpMode::DELETE);
@@ -1202,34 +1838,7 @@ bool ShaderDiskCache::InitGSCache(const std::atomic_bool& stop_loading,
             // These will be regenerated from the cached config later.
             // Also, only use SPIRV entries if we support geometry shaders on this device.
             if (geo_shaders_needed && !regenerate_file) {
-                LOG_DEBUG(Render_Vulkan, "    processing SPIRV.");
-
-                curr = gs_cache.ReadAt(curr_offset);
-                if (!curr.Valid() || curr.Type() != CacheEntryType::GS_SPIRV) {
-                    MALFORMED_DISK_CACHE;
-                }
-
-                const u8* spirv_data = curr.Data().data();
-                const size_t spirv_size = curr.Data().size();
-
-                auto [iter_spirv, new_program] =
-                    fixed_geometry_shaders.try_emplace(curr.Id(), parent.instance);
-                if (new_program) {
-                    LOG_DEBUG(Render_Vulkan, "    compiling SPIRV.");
-
-                    const auto spirv = std::span<const u32>(
-                        reinterpret_cast<const u32*>(spirv_data), spirv_size / sizeof(u32));
-
-                    iter_spirv->second.module = CompileSPV(spirv, parent.instance.GetDevice());
-                    iter_spirv->second.MarkDone();
-
-                    if (!iter_spirv->second.module) {
-                        // Compilation failed for some reason, remove from cache to let it
-                        // be regenerated at runtime or during config processing.
-                        LOG_ERROR(Render_Vulkan, "Unexpected program compilation failure");
-                        fixed_geometry_shaders.erase(iter_spirv);
-                    }
-                }
+                pending_spirv.push_back({curr_header.Id(), curr_offset});
             }
 
             if (callback) {
@@ -1241,6 +1850,9 @@ bool ShaderDiskCache::InitGSCache(const std::atomic_bool& stop_loading,
         }
     }
 
+    // Failed modules are dropped, so that they get regenerated during config processing.
+    CompileCachedSPIRV(gs_cache, pending_spirv, fixed_geometry_shaders);
+
     // Once we have all the shader instances created from SPIRV, we can link them to the FS configs.
     LOG_DEBUG(Render_Vulkan, "Linking with config entries.");
 
@@ -1283,41 +1895,54 @@ bool ShaderDiskCache::InitGSCache(const std::atomic_bool& stop_loading,
             continue;
         }
 
-        const auto [it, new_shader] =
-            fixed_geometry_shaders.try_emplace(gs_config_hash, parent.instance);
-        auto& shader = it->second;
-
-        std::vector<u32> spirv;
         ExtraFixedGSConfig extra;
         extra.use_clip_planes = parent.profile.has_clip_planes;
         extra.separable_shader = true;
 
-        const auto code_glsl = GLSL::GenerateFixedGeometryShader(entry->gs_config, extra);
+        auto code_glsl = GLSL::GenerateFixedGeometryShader(entry->gs_config, extra);
 
         if (code_glsl.empty()) {
             LOG_ERROR(Render_Vulkan, "Failed to retrieve fixed geometry shader");
-            fixed_geometry_shaders.erase(it);
             continue;
         }
 
-        spirv = CompileGLSL(code_glsl, vk::ShaderStageFlagBits::eGeometry);
-        shader.module = CompileSPV(spirv, parent.instance.GetDevice());
-        shader.MarkDone();
+        const auto [it, new_shader] =
+            fixed_geometry_shaders.try_emplace(gs_config_hash, parent.instance);
+        auto& shader = it->second;
+        shader.program = std::move(code_glsl);
+
+        CacheFile* spirv_file = regenerate_file.get();
+        parent.shader_workers.QueueWork([this, &shader, spirv_file, gs_config_hash,
+                                         config_entry = *entry] {
+            const auto spirv = CompileGLSL(shader.program, vk::ShaderStageFlagBits::eGeometry,
+                                           parent.profile.vk_disable_spirv_optimizer);
+            shader.program.clear();
+            if (spirv.empty()) {
+                LOG_ERROR(Render_Vulkan, "Failed to regenerate fixed geometry shader {:016X}",
+                          gs_config_hash);
+                shader.MarkDone();
+                std::scoped_lock lock{failed_shaders_mutex};
+                failed_shaders.emplace_back(ProgramType::GS, gs_config_hash);
+                return;
+            }
+            shader.module = CompileSPV(spirv, parent.instance.GetDevice());
+            shader.MarkDone();
 
-        if (regenerate_file) {
-            // Append the config and SPIRV to the new file.
-            AppendGSSPIRV(*regenerate_file, spirv, gs_config_hash);
-            AppendGSConfig(*regenerate_file, *entry, gs_config_hash);
-        }
+            if (spirv_file) {
+                // Append the config and SPIRV to the new file.
+                AppendGSSPIRV(*spirv_file, spirv, gs_config_hash);
+                AppendGSConfig(*spirv_file, config_entry, gs_config_hash);
+            }
+        });
 
         LOG_DEBUG(Render_Vulkan, "    linked with new SPIRV.");
     }
 
     if (regenerate_file) {
-        // If we are regenerating, replace the old file with the new one.
-        gs_cache.SwitchMode(CacheFile::CacheOpMode::DELETE);
-        regenerate_file.reset();
-        FileUtil::Rename(GetGSFile(title_id, true), GetGSFile(title_id, false));
+        // The workers are still writing to the new file, it replaces the old one once they are
+        // done.
+        regenerated_files.emplace_back(CacheFileType::GS_CACHE, std::move(regenerate_file));
+        return true;
     }
 
     // Switch to append mode to receive new entries.
@@ -1327,7 +1952,10 @@ bool ShaderDiskCache::InitGSCache(const std::atomic_bool& stop_loading,
 bool ShaderDiskCache::InitPLCache(const std::atomic_bool& stop_loading,
                                   const VideoCore::DiskResourceLoadCallback& callback) {
 
-    auto cleanup_on_error = [&]() { graphics_pipelines.clear(); };
+    auto cleanup_on_error = [&]() {
+        parent.pipeline_workers.WaitForRequests();
+        graphics_pipelines.clear();
+    };
 
     LOG_INFO(Render_Vulkan, "Loading PL disk shader cache for title {:016X}", title_id);
 
@@ -1456,7 +2084,8 @@ bool ShaderDiskCache::InitPLCache(const std::atomic_bool& stop_loading,
                 parent.instance, parent.renderpass_cache, info, *parent.driver_pipeline_cache,
                 *parent.pipeline_layout, shaders, &parent.pipeline_workers);
 
-            it_pl.value()->TryBuild(false);
+            // Build on the workers, which wait for any shader still being compiled.
+            it_pl.value()->BuildAsync();
 
             LOG_DEBUG(Render_Vulkan, "    built.");
 
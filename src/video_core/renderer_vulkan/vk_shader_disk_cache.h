@@ -27,6 +27,7 @@ class PipelineCache;
 class ShaderDiskCache {
 public:
     ShaderDiskCache(PipelineCache& _parent, u64 _title_id) : parent(_parent), title_id(_title_id) {}
+    ~ShaderDiskCache();
 
     void Init(const std::atomic_bool& stop_loading,
               const VideoCore::DiskResourceLoadCallback& callback);
@@ -35,6 +36,13 @@ public:
         const Pica::RegsInternal& regs, Pica::ShaderSetup& setup, const VertexLayout& layout);
     std::optional<std::pair<u64, Shader* const>> UseFragmentShader(
         const Pica::RegsInternal& regs, const Pica::Shader::UserConfig& user);
+    /**
+     * Returns the uber fragment shader matching the PICA state outside of the TEV stages and
+     * alpha test. Uber shaders are never written to the disk cache, and keep a null module if
+     * they fail to build.
+     */
+    std::pair<u64, Shader* const> UseUberFragmentShader(const Pica::RegsInternal& regs,
+                                                        const Pica::Shader::UserConfig& user);
     std::optional<std::pair<u64, Shader* const>> UseFixedGeometryShader(
         const Pica::RegsInternal& regs);
 
@@ -44,7 +52,21 @@ public:
         return title_id;
     }
 
+    /**
+     * Regenerates the SPIR-V of every config stored in the transferable cache of a title,
+     * without a Vulkan device. The shaders are generated for the profile recorded in the source
+     * files, so the output is ready to use on any system reporting the same profile.
+     * @param src_dir Directory containing the source transferable cache files.
+     * @param dst_dir Directory receiving the rebuilt files, which may be src_dir.
+     * @param num_threads Number of threads generating shaders.
+     * @returns True if the title had cache files and all of them were rebuilt.
+     */
+    static bool BuildTransferableCache(u64 title_id, const std::string& src_dir,
+                                       const std::string& dst_dir, std::size_t num_threads);
+
 private:
+    friend struct ShaderDiskCacheTest;
+
     static constexpr std::size_t SOURCE_FILE_HASH_LENGTH = 64;
     using SourceFileCacheVersionHash = std::array<u8, SOURCE_FILE_HASH_LENGTH>;
 
@@ -264,6 +286,8 @@ private:
             filepath = path;
         }
 
+        // Reads are served from the file contents loaded when switching to READ mode, so they
+        // may be done from several threads at once.
         CacheEntry ReadFirst();
         CacheEntry ReadNext(const CacheEntry& previous);
 
@@ -298,12 +322,14 @@ private:
         std::string filepath;
         FileUtil::IOFile file{};
         size_t file_size;
-        size_t cached_file_data_start{};
         std::vector<u8> cached_file_data;
         std::atomic<size_t> next_entry_id = SIZE_MAX;
         Common::ThreadWorker append_worker{1, "Disk Shader Cache Append Worker"};
     };
 
+    static std::string GetCacheFile(const std::string& dir, u64 title_id, CacheFileType type,
+                                    bool is_temp);
+
     std::string GetVSFile(u64 title_id, bool is_temp) const;
     std::string GetFSFile(u64 title_id, bool is_temp) const;
     std::string GetGSFile(u64 title_id, bool is_temp) const;
@@ -311,6 +337,30 @@ private:
 
     bool RecreateCache(CacheFile& file, CacheFileType type);
 
+    static void AppendFileInfo(CacheFile& file, CacheFileType type,
+                               const Pica::Shader::Profile& profile);
+
+    /// Opens a cache file for reading and returns its header if it is usable by this build.
+    static std::optional<FileInfoEntry> ReadFileInfo(CacheFile& file, CacheFileType type);
+
+    static bool BuildVSCacheOffline(const std::string& src_path, const std::string& dst_path,
+                                    Common::ThreadWorker& workers);
+    static bool BuildFSCacheOffline(const std::string& src_path, const std::string& dst_path,
+                                    Common::ThreadWorker& workers);
+    static bool BuildGSCacheOffline(const std::string& src_path, const std::string& dst_path,
+                                    Common::ThreadWorker& workers);
+
+    /**
+     * Creates the shader modules of cached SPIRV entries on the shader workers and waits for
+     * them. Entries which fail to compile are removed from the map.
+     */
+    template <typename Map>
+    void CompileCachedSPIRV(CacheFile& file, std::span<const std::pair<u64, size_t>> entries,
+                            Map& shaders);
+
+    /// Removes the shaders which failed to regenerate. Must not run while a pipeline uses them.
+    void RemoveFailedShaders();
+
     bool InitVSCache(const std::atomic_bool& stop_loading,
                      const VideoCore::DiskResourceLoadCallback& callback);
 
@@ -325,23 +375,30 @@ private:
 
     void AppendVSConfigProgram(CacheFile& file, const Pica::Shader::Generator::PicaVSConfig& config,
                                const Pica::ShaderSetup& setup, u64 config_id, u64 program_id);
-    void AppendVSProgram(CacheFile& file, const VSProgramEntry& entry, u64 program_id);
-    void AppendVSConfig(CacheFile& file, const VSConfigEntry& entry, u64 config_id);
-    void AppendVSSPIRV(CacheFile& file, std::span<const u32> program, u64 program_id);
+    static void AppendVSProgram(CacheFile& file, const VSProgramEntry& entry, u64 program_id);
+    static void AppendVSConfig(CacheFile& file, const VSConfigEntry& entry, u64 config_id);
+    static void AppendVSSPIRV(CacheFile& file, std::span<const u32> program, u64 program_id);
 
-    void AppendFSConfig(CacheFile& file, const FSConfigEntry& entry, u64 config_id);
-    void AppendFSSPIRV(CacheFile& file, std::span<const u32> program, u64 program_id);
+    static void AppendFSConfig(CacheFile& file, const FSConfigEntry& entry, u64 config_id);
+    static void AppendFSSPIRV(CacheFile& file, std::span<const u32> program, u64 program_id);
 
-    void AppendGSConfig(CacheFile& file, const GSConfigEntry& entry, u64 config_id);
-    void AppendGSSPIRV(CacheFile& file, std::span<const u32> program, u64 program_id);
+    static void AppendGSConfig(CacheFile& file, const GSConfigEntry& entry, u64 config_id);
+    static void AppendGSSPIRV(CacheFile& file, std::span<const u32> program, u64 program_id);
 
-    void AppendPLConfig(CacheFile& file, const PLConfigEntry& entry, u64 config_id);
+    static void AppendPLConfig(CacheFile& file, const PLConfigEntry& entry, u64 config_id);
+
+    /// Shaders the workers failed to regenerate, removed from their maps once the workers are done.
+    std::vector<std::pair<Pica::Shader::Generator::ProgramType, u64>> failed_shaders;
+    std::mutex failed_shaders_mutex;
 
     CacheFile vs_cache;
     CacheFile fs_cache;
     CacheFile gs_cache;
     CacheFile pl_cache;
 
+    /// Regenerated cache files which replace the loaded ones once the shader workers are done.
+    std::vector<std::pair<CacheFileType, std::unique_ptr<CacheFile>>> regenerated_files;
+
     PipelineCache& parent;
     u64 title_id;
 
@@ -350,6 +407,9 @@ private:
     std::unordered_set<u64> known_vertex_programs;
 
     std::unordered_map<u64, Shader> fragment_shaders;
+    /// Maps the hash of a config built from the registers to its canonical shader.
+    std::unordered_map<u64, std::pair<u64, Shader*>> raw_fragment_configs;
+    std::unordered_map<u64, Shader> uber_fragment_shaders;
 
     std::unordered_map<size_t, Shader> fixed_geometry_shaders;
     std::unordered_set<u64> known_geometry_shaders;
@@ -142,26 +142,24 @@ EShLanguage ToEshShaderStage(vk::ShaderStageFlagBits stage) {
 }
 
 bool InitializeCompiler() {
-    static bool glslang_initialized = false;
-
-    if (glslang_initialized) {
+    // Shaders may be compiled from several threads at once, so rely on the thread-safe
+    // initialization of statics.
+    static const bool glslang_initialized = [] {
+        if (!glslang::InitializeProcess()) {
+            LOG_CRITICAL(Render_Vulkan, "Failed to initialize glslang shader compiler");
+            return false;
+        }
+
+        std::atexit([]() { glslang::FinalizeProcess(); });
         return true;
-    }
-
-    if (!glslang::InitializeProcess()) {
-        LOG_CRITICAL(Render_Vulkan, "Failed to initialize glslang shader compiler");
-        return false;
-    }
-
-    std::atexit([]() { glslang::FinalizeProcess(); });
+    }();
 
-    glslang_initialized = true;
-    return true;
+    return glslang_initialized;
 }
 } // Anonymous namespace
 
 std::vector<u32> CompileGLSL(std::string_view code, vk::ShaderStageFlagBits stage,
-                             std::string_view premable) {
+                             bool disable_optimizer, std::string_view premable) {
     if (!InitializeCompiler()) {
         return {};
     }
@@ -205,7 +203,7 @@ std::vector<u32> CompileGLSL(std::string_view code, vk::ShaderStageFlagBits stag
     glslang::SpvOptions options;
 
     // Controls optimizations on the generated SPIR-V code.
-    options.disableOptimizer = Settings::values.disable_spirv_optimizer.GetValue();
+    options.disableOptimizer = disable_optimizer;
     options.validate = false;
     options.optimizeSize = true;
 
@@ -237,7 +235,8 @@ vk::ShaderModule CompileSPV(std::span<const u32> code, vk::Device device) {
 
 vk::ShaderModule Compile(std::string_view code, vk::ShaderStageFlagBits stage, vk::Device device,
                          std::string_view premable) {
-    return CompileSPV(CompileGLSL(code, stage, premable), device);
+    const bool disable_optimizer = Settings::values.disable_spirv_optimizer.GetValue();
+    return CompileSPV(CompileGLSL(code, stage, disable_optimizer, premable), device);
 }
 
 } // namespace Vulkan
@@ -14,9 +14,10 @@ namespace Vulkan {
  * @brief Creates a vulkan shader module from GLSL by converting it to SPIR-V using glslang.
  * @param code The string containing GLSL code.
  * @param stage The pipeline stage the shader will be used in.
+ * @param disable_optimizer Whether to skip optimizations on the generated SPIR-V.
  */
 std::vector<u32> CompileGLSL(std::string_view code, vk::ShaderStageFlagBits stage,
-                             std::string_view premable = "");
+                             bool disable_optimizer, std::string_view premable = "");
 
 /**
  * @brief Creates a vulkan shader module from SPIR-V bytecode.
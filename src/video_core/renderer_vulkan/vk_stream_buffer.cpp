@@ -174,6 +174,18 @@ void StreamBuffer::Commit(u32 size) {
     watch.tick = scheduler.CurrentTick();
 }
 
+void StreamBuffer::Invalidate(u32 offset, u32 size) {
+    if (is_coherent) {
+        return;
+    }
+    const vk::MappedMemoryRange range = {
+        .memory = memory,
+        .offset = offset,
+        .size = size,
+    };
+    device.invalidateMappedMemoryRanges(range);
+}
+
 void StreamBuffer::CreateBuffers(u64 preferred_size) {
     const vk::Device device = instance.GetDevice();
     const auto memory_properties = instance.GetPhysicalDevice().getMemoryProperties();
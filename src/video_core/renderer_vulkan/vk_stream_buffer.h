@@ -40,6 +40,9 @@ public:
     /// Ensures that "size" bytes of memory are available to the GPU, potentially recording a copy.
     void Commit(u32 size);
 
+    /// Makes GPU writes to a committed region visible to the host, when memory is not coherent.
+    void Invalidate(u32 offset, u32 size);
+
     vk::Buffer Handle() const noexcept {
         return buffer;
     }
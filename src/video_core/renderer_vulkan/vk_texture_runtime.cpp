@@ -19,7 +19,6 @@
 
 #include "common/literals.h"
 #include "common/microprofile.h"
-#include "common/scope_exit.h"
 #include "video_core/custom_textures/material.h"
 #include "video_core/rasterizer_cache/texture_codec.h"
 #include "video_core/rasterizer_cache/utils.h"
@@ -283,8 +282,9 @@ TextureRuntime::TextureRuntime(const Instance& instance, Scheduler& scheduler,
                                u32 num_swapchain_images_)
     : instance{instance}, scheduler{scheduler}, renderpass_cache{renderpass_cache},
       blit_helper{instance, scheduler, renderpass_cache, update_queue},
-      upload_buffer{instance, scheduler, vk::BufferUsageFlagBits::eTransferSrc, UPLOAD_BUFFER_SIZE,
-                    BufferType::Upload},
+      upload_buffer{instance, scheduler,
+                    vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eStorageBuffer,
+                    UPLOAD_BUFFER_SIZE, BufferType::Upload},
       download_buffer{instance, scheduler,
                       vk::BufferUsageFlagBits::eTransferDst |
                           vk::BufferUsageFlagBits::eStorageBuffer,
@@ -296,6 +296,9 @@ TextureRuntime::~TextureRuntime() = default;
 VideoCore::StagingData TextureRuntime::FindStaging(u32 size, bool upload) {
     StreamBuffer& buffer = upload ? upload_buffer : download_buffer;
     const auto [data, offset, invalidate] = buffer.Map(size, 16);
+    if (invalidate && !upload) {
+        download_wrap_tick = scheduler.CurrentTick();
+    }
     return VideoCore::StagingData{
         .size = size,
         .offset = offset,
@@ -303,6 +306,40 @@ VideoCore::StagingData TextureRuntime::FindStaging(u32 size, bool upload) {
     };
 }
 
+std::optional<VideoCore::StagingData> TextureRuntime::DecodeTiled(
+    const VideoCore::SurfaceParams& params, std::span<const u8> data) {
+    const auto type = VideoCore::GetFormatType(params.pixel_format);
+    if (!params.is_tiled || (type != SurfaceType::Color && type != SurfaceType::Texture) ||
+        instance.GetTraits(params.pixel_format).native != vk::Format::eR8G8B8A8Unorm) {
+        return std::nullopt;
+    }
+
+    // Place the decoded texels first so the staging can be passed to Surface::Upload as is.
+    const u64 alignment = std::max<u64>(instance.StorageMinAlignment(), 16);
+    const u32 decoded_size = params.width * params.height * 4;
+    const u32 tiled_offset = Common::AlignUp(decoded_size, alignment);
+    const u32 size = tiled_offset + static_cast<u32>(data.size());
+
+    const auto [mapped, offset, invalidate] = upload_buffer.Map(size, alignment);
+    std::memcpy(mapped + tiled_offset, data.data(), data.size());
+    blit_helper.DecodeTexture(params, upload_buffer.Handle(), offset + tiled_offset, offset);
+
+    return VideoCore::StagingData{
+        .size = size,
+        .offset = offset,
+        .mapped = std::span{mapped, size},
+    };
+}
+
+bool TextureRuntime::FinishDownload(u64 fence, const VideoCore::StagingData& staging) {
+    if (download_wrap_tick >= fence) {
+        return false;
+    }
+    scheduler.Wait(fence);
+    download_buffer.Invalidate(staging.offset, staging.size);
+    return true;
+}
+
 u64 TextureRuntime::GetResourceTick() {
     return scheduler.GetMasterSemaphore()->KnownGpuTick();
 }
@@ -1013,11 +1050,23 @@ void Surface::UploadCustom(const VideoCore::Material* material, u32 level) {
 
 void Surface::Download(const VideoCore::BufferTextureCopy& download,
                        const VideoCore::StagingData& staging) {
-    SCOPE_EXIT({
-        scheduler.Finish();
-        runtime.download_buffer.Commit(staging.size);
-    });
+    RecordDownload(download);
+    scheduler.Finish();
+    runtime.download_buffer.Commit(staging.size);
+}
+
+u64 Surface::DownloadAsync(const VideoCore::BufferTextureCopy& download,
+                           const VideoCore::StagingData& staging) {
+    RecordDownload(download);
+    runtime.download_buffer.Commit(staging.size);
+
+    // Submit right away so the copy overlaps with emulation.
+    const u64 fence = scheduler.CurrentTick();
+    scheduler.Flush();
+    return fence;
+}
 
+void Surface::RecordDownload(const VideoCore::BufferTextureCopy& download) {
     runtime.renderpass_cache.EndRendering();
 
     if (pixel_format == PixelFormat::D24S8) {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <optional>
 #include <span>
 #include "video_core/rasterizer_cache/framebuffer_base.h"
 #include "video_core/rasterizer_cache/rasterizer_cache_base.h"
@@ -135,6 +136,20 @@ public:
     /// Maps an internal staging buffer of the provided size for pixel uploads/downloads
     VideoCore::StagingData FindStaging(u32 size, bool upload);
 
+    /// Returns true if Surface::DownloadAsync completes without waiting for the GPU
+    bool SupportsAsyncDownload() const noexcept {
+        return true;
+    }
+
+    /// Waits for a download started with Surface::DownloadAsync. Returns false if its staging
+    /// memory may have been reused since, in which case the download has to be repeated.
+    bool FinishDownload(u64 fence, const VideoCore::StagingData& staging);
+
+    /// Stages the tiled texels of an upload and decodes them on the GPU. Returns the staging
+    /// holding the decoded texels, or std::nullopt if the format must be decoded on the CPU.
+    std::optional<VideoCore::StagingData> DecodeTiled(const VideoCore::SurfaceParams& params,
+                                                      std::span<const u8> data);
+
     /// Attempts to reinterpret a rectangle of source to another rectangle of dest
     bool Reinterpret(Surface& source, Surface& dest, const VideoCore::TextureCopy& copy);
 
@@ -169,6 +184,7 @@ private:
     BlitHelper blit_helper;
     StreamBuffer upload_buffer;
     StreamBuffer download_buffer;
+    u64 download_wrap_tick{};
     u32 num_swapchain_images;
 };
 
@@ -253,6 +269,11 @@ public:
     void Download(const VideoCore::BufferTextureCopy& download,
                   const VideoCore::StagingData& staging);
 
+    /// Starts downloading pixel data to staging without waiting for the GPU.
+    /// Returns the fence to pass to TextureRuntime::FinishDownload.
+    u64 DownloadAsync(const VideoCore::BufferTextureCopy& download,
+                      const VideoCore::StagingData& staging);
+
     /// Scales up the surface to match the new resolution scale.
     void ScaleUp(u32 new_scale);
 
@@ -269,6 +290,9 @@ private:
     /// Performs blit between the scaled/unscaled images
     void BlitScale(const VideoCore::TextureBlit& blit, bool up_scale);
 
+    /// Records the commands copying a rectangle region of the surface texture to staging
+    void RecordDownload(const VideoCore::BufferTextureCopy& download);
+
     /// Downloads scaled depth stencil data
     void DepthStencilDownload(const VideoCore::BufferTextureCopy& download,
                               const VideoCore::StagingData& staging);
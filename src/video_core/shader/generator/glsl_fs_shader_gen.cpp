@@ -98,6 +98,8 @@ layout (binding = 2, std140) uniform fs_data {
     vec3 tex_lod_bias;
     vec4 tex_border_color[3];
     vec4 blend_color;
+    uvec4 tev_stage_config[NUM_TEV_STAGES];
+    uvec4 tev_config;
 };
 )";
 
@@ -120,6 +122,9 @@ FragmentModule::FragmentModule(const FSConfig& config_, const UserConfig& user_,
     for (u32 i = 0; i < 4; i++) {
         DefineTexUnitSampler(i);
     }
+    if (user.use_uber_tev) {
+        DefineUberTevHelpers();
+    }
 }
 
 FragmentModule::~FragmentModule() = default;
@@ -159,13 +164,18 @@ vec4 secondary_fragment_color = vec4(0.0);
            "float alpha_results_2 = 0.0;\n"
            "float alpha_results_3 = 0.0;\n";
 
-    // Write shader source to emulate PICA TEV stages
-    for (u32 index = 0; index < config.texture.tev_stages.size(); index++) {
-        WriteTevStage(index);
-    }
+    if (user.use_uber_tev) {
+        // Write shader source to evaluate the TEV stages and alpha test from the uniforms
+        WriteUberTev();
+    } else {
+        // Write shader source to emulate PICA TEV stages
+        for (u32 index = 0; index < config.texture.tev_stages.size(); index++) {
+            WriteTevStage(index);
+        }
 
-    // Append the alpha test condition
-    WriteAlphaTestCondition(config.framebuffer.alpha_test_func);
+        // Append the alpha test condition
+        WriteAlphaTestCondition(config.framebuffer.alpha_test_func);
+    }
 
     // Emulate the fog
     switch (config.texture.fog_mode) {
@@ -482,6 +492,71 @@ void FragmentModule::WriteTevStage(u32 index) {
     }
 }
 
+void FragmentModule::WriteUberTev() {
+    // Sample every texture unit up front, as derivatives are undefined in the non-uniform control
+    // flow of the stage loop. Sources 7-12 are invalid and read as zero.
+    out += R"(
+vec4 tev_sources[16];
+for (int i = 0; i < 16; i++) {
+    tev_sources[i] = vec4(0.0);
+}
+tev_sources[0] = rounded_primary_color;
+tev_sources[1] = primary_fragment_color;
+tev_sources[2] = secondary_fragment_color;
+tev_sources[3] = sampleTexUnit0();
+tev_sources[4] = sampleTexUnit1();
+tev_sources[5] = sampleTexUnit2();
+tev_sources[6] = sampleTexUnit3();
+vec3 uber_color_results[3];
+float uber_alpha_results[3];
+for (int stage = 0; stage < NUM_TEV_STAGES; stage++) {
+    uvec4 tev_stage = tev_stage_config[stage];
+    tev_sources[13] = combiner_buffer;
+    tev_sources[14] = const_color[stage];
+    tev_sources[15] = combiner_output;
+    if (!IsPassThroughTevStage(tev_stage)) {
+        for (uint i = 0u; i < 3u; i++) {
+            uint color_source = (tev_stage.x >> (4u * i)) & 0xFu;
+            uint alpha_source = (tev_stage.x >> (16u + 4u * i)) & 0xFu;
+            // The first stage reads its third source in place of the previous output
+            if (stage == 0 && color_source == 15u) {
+                color_source = (tev_stage.x >> 8u) & 0xFu;
+            }
+            if (stage == 0 && alpha_source == 15u) {
+                alpha_source = (tev_stage.x >> 24u) & 0xFu;
+            }
+            uber_color_results[i] = GetTevColorModifier((tev_stage.y >> (4u * i)) & 0xFu,
+                                                        tev_sources[color_source]);
+            uber_alpha_results[i] = GetTevAlphaModifier((tev_stage.y >> (12u + 4u * i)) & 0x7u,
+                                                        tev_sources[alpha_source]);
+        }
+        uint color_op = tev_stage.z & 0xFu;
+        uint alpha_op = (tev_stage.z >> 16u) & 0xFu;
+        vec3 color_output = byteround(GetTevColorCombiner(color_op, uber_color_results[0],
+                                      uber_color_results[1], uber_color_results[2]));
+        // The result of the Dot3_RGBA operation is also placed in the alpha component
+        float alpha_output = color_op == 7u ? color_output[0] :
+                             byteround(GetTevAlphaCombiner(alpha_op, uber_alpha_results[0],
+                                       uber_alpha_results[1], uber_alpha_results[2]));
+        combiner_output = vec4(
+            clamp(color_output * GetTevMultiplier(tev_stage.w & 3u), vec3(0.0), vec3(1.0)),
+            clamp(alpha_output * GetTevMultiplier((tev_stage.w >> 16u) & 3u), 0.0, 1.0));
+    }
+    combiner_buffer = next_combiner_buffer;
+    if (stage < 4) {
+        uint stage_bit = 1u << uint(stage);
+        if ((tev_config.x & stage_bit) != 0u) {
+            next_combiner_buffer.rgb = combiner_output.rgb;
+        }
+        if (((tev_config.x >> 4u) & stage_bit) != 0u) {
+            next_combiner_buffer.a = combiner_output.a;
+        }
+    }
+}
+if (TevAlphaTestFails(tev_config.y, int(combiner_output.a * 255.0))) discard;
+)";
+}
+
 void FragmentModule::WriteLighting() {
     if (!config.lighting.enable) {
         return;
@@ -1395,6 +1470,98 @@ uvec2 DecodeShadow(uint pixel) {
 )";
 }
 
+void FragmentModule::DefineUberTevHelpers() {
+    out += R"(
+bool IsPassThroughTevStage(uvec4 stage) {
+    uint color_scale = stage.w & 3u;
+    uint alpha_scale = (stage.w >> 16u) & 3u;
+    return (stage.x & 0xF000Fu) == 0xF000Fu && (stage.y & 0x700Fu) == 0u &&
+           (stage.z & 0xF000Fu) == 0u && (color_scale == 0u || color_scale == 3u) &&
+           (alpha_scale == 0u || alpha_scale == 3u);
+}
+
+float GetTevMultiplier(uint scale) {
+    return scale < 3u ? float(1u << scale) : 1.0;
+}
+
+vec3 GetTevColorModifier(uint modifier, vec4 color) {
+    switch (modifier) {
+    case 0u: return color.rgb;
+    case 1u: return vec3(1.0) - color.rgb;
+    case 2u: return color.aaa;
+    case 3u: return vec3(1.0) - color.aaa;
+    case 4u: return color.rrr;
+    case 5u: return vec3(1.0) - color.rrr;
+    case 8u: return color.ggg;
+    case 9u: return vec3(1.0) - color.ggg;
+    case 12u: return color.bbb;
+    case 13u: return vec3(1.0) - color.bbb;
+    default: return vec3(0.0);
+    }
+}
+
+float GetTevAlphaModifier(uint modifier, vec4 color) {
+    switch (modifier) {
+    case 0u: return color.a;
+    case 1u: return 1.0 - color.a;
+    case 2u: return color.r;
+    case 3u: return 1.0 - color.r;
+    case 4u: return color.g;
+    case 5u: return 1.0 - color.g;
+    case 6u: return color.b;
+    default: return 1.0 - color.b;
+    }
+}
+
+vec3 GetTevColorCombiner(uint op, vec3 r1, vec3 r2, vec3 r3) {
+    vec3 result = vec3(0.0);
+    switch (op) {
+    case 0u: result = r1; break;
+    case 1u: result = r1 * r2; break;
+    case 2u: result = r1 + r2; break;
+    case 3u: result = r1 + r2 - vec3(0.5); break;
+    case 4u: result = mix(r2, r1, r3); break;
+    case 5u: result = r1 - r2; break;
+    case 6u:
+    case 7u: result = vec3(dot(r1 - vec3(0.5), r2 - vec3(0.5)) * 4.0); break;
+    case 8u: result = fma(r1, r2, r3); break;
+    case 9u: result = min(r1 + r2, vec3(1.0)) * r3; break;
+    default: break;
+    }
+    return clamp(result, vec3(0.0), vec3(1.0));
+}
+
+float GetTevAlphaCombiner(uint op, float r1, float r2, float r3) {
+    float result = 0.0;
+    switch (op) {
+    case 0u: result = r1; break;
+    case 1u: result = r1 * r2; break;
+    case 2u: result = r1 + r2; break;
+    case 3u: result = r1 + r2 - 0.5; break;
+    case 4u: result = mix(r2, r1, r3); break;
+    case 5u: result = r1 - r2; break;
+    case 8u: result = fma(r1, r2, r3); break;
+    case 9u: result = min(r1 + r2, 1.0) * r3; break;
+    default: break;
+    }
+    return clamp(result, 0.0, 1.0);
+}
+
+bool TevAlphaTestFails(uint func, int alpha) {
+    switch (func) {
+    case 0u: return true;
+    case 2u: return alpha != alphatest_ref;
+    case 3u: return alpha == alphatest_ref;
+    case 4u: return alpha >= alphatest_ref;
+    case 5u: return alpha > alphatest_ref;
+    case 6u: return alpha <= alphatest_ref;
+    case 7u: return alpha < alphatest_ref;
+    default: return false;
+    }
+}
+)";
+}
+
 void FragmentModule::DefineLightingHelpers() {
     if (!config.lighting.enable) {
         return;
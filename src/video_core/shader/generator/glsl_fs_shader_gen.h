@@ -64,6 +64,9 @@ private:
     /// Writes the code to emulate the specified TEV stage
     void WriteTevStage(u32 index);
 
+    /// Writes the code to evaluate all TEV stages and the alpha test from the uniforms
+    void WriteUberTev();
+
     void AppendProcTexShiftOffset(std::string_view v, Pica::TexturingRegs::ProcTexShift mode,
                                   Pica::TexturingRegs::ProcTexClamp clamp_mode);
 
@@ -77,6 +80,7 @@ private:
     void DefineBindingsVK();
     void DefineBindingsGL();
     void DefineHelpers();
+    void DefineUberTevHelpers();
     void DefineLightingHelpers();
     void DefineShadowHelpers();
     void DefineProcTexSampler();
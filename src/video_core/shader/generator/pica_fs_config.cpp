@@ -207,4 +207,172 @@ FSConfig::FSConfig(const Pica::RegsInternal& regs)
     : framebuffer{regs}, texture{regs.texturing}, lighting{regs.lighting}, proctex{regs.texturing} {
 }
 
+using TevStageConfig = Pica::TexturingRegs::TevStageConfig;
+
+/// Returns the number of combiner inputs read by a TEV operation
+static u32 NumTevOperands(TevStageConfig::Operation op) {
+    switch (op) {
+    case TevStageConfig::Operation::Replace:
+        return 1;
+    case TevStageConfig::Operation::Modulate:
+    case TevStageConfig::Operation::Add:
+    case TevStageConfig::Operation::AddSigned:
+    case TevStageConfig::Operation::Subtract:
+    case TevStageConfig::Operation::Dot3_RGB:
+    case TevStageConfig::Operation::Dot3_RGBA:
+        return 2;
+    default:
+        return 3;
+    }
+}
+
+static TevStageConfigRaw CanonicalizeTevStage(const TevStageConfigRaw& raw, u32 index) {
+    TevStageConfig stage = raw;
+
+    // Drop the register bits that don't belong to any field
+    stage.sources_raw &= 0x0FFF0FFF;
+    stage.modifiers_raw &= 0x00777FFF;
+    stage.ops_raw &= 0x000F000F;
+    stage.scales_raw &= 0x00030003;
+
+    // Multipliers 0 and 3 both scale by one
+    if (stage.color_scale == 3) {
+        stage.color_scale.Assign(0);
+    }
+    if (stage.alpha_scale == 3) {
+        stage.alpha_scale.Assign(0);
+    }
+
+    // Passthrough stages are skipped entirely by the generators
+    if (stage.color_op == TevStageConfig::Operation::Replace &&
+        stage.alpha_op == TevStageConfig::Operation::Replace &&
+        stage.color_source1 == TevStageConfig::Source::Previous &&
+        stage.alpha_source1 == TevStageConfig::Source::Previous &&
+        stage.color_modifier1 == TevStageConfig::ColorModifier::SourceColor &&
+        stage.alpha_modifier1 == TevStageConfig::AlphaModifier::SourceAlpha &&
+        stage.scales_raw == 0) {
+        TevStageConfig passthrough{};
+        passthrough.color_source1.Assign(TevStageConfig::Source::Previous);
+        passthrough.alpha_source1.Assign(TevStageConfig::Source::Previous);
+        return {passthrough.sources_raw, 0, 0, 0};
+    }
+
+    // The first stage reads its third source in place of the previous stage output, so only
+    // drop it when no used operand refers to the previous output.
+    const auto reads_previous = [index](u32 num_operands, auto source1, auto source2) {
+        return index == 0 && ((source1 == TevStageConfig::Source::Previous) ||
+                              (num_operands > 1 && source2 == TevStageConfig::Source::Previous));
+    };
+
+    const u32 num_color = NumTevOperands(stage.color_op);
+    if (num_color < 3) {
+        if (!reads_previous(num_color, stage.color_source1.Value(), stage.color_source2.Value())) {
+            stage.color_source3.Assign(TevStageConfig::Source::PrimaryColor);
+        }
+        stage.color_modifier3.Assign(TevStageConfig::ColorModifier::SourceColor);
+    }
+    if (num_color < 2) {
+        stage.color_source2.Assign(TevStageConfig::Source::PrimaryColor);
+        stage.color_modifier2.Assign(TevStageConfig::ColorModifier::SourceColor);
+    }
+
+    // Dot3_RGBA already has its alpha state cleared
+    if (stage.color_op != TevStageConfig::Operation::Dot3_RGBA) {
+        const u32 num_alpha = NumTevOperands(stage.alpha_op);
+        if (num_alpha < 3) {
+            if (!reads_previous(num_alpha, stage.alpha_source1.Value(),
+                                stage.alpha_source2.Value())) {
+                stage.alpha_source3.Assign(TevStageConfig::Source::PrimaryColor);
+            }
+            stage.alpha_modifier3.Assign(TevStageConfig::AlphaModifier::SourceAlpha);
+        }
+        if (num_alpha < 2) {
+            stage.alpha_source2.Assign(TevStageConfig::Source::PrimaryColor);
+            stage.alpha_modifier2.Assign(TevStageConfig::AlphaModifier::SourceAlpha);
+        }
+    }
+
+    return {stage.sources_raw, stage.modifiers_raw, stage.ops_raw, stage.scales_raw};
+}
+
+void FSConfig::Canonicalize() {
+    using LightingSampler = Pica::LightingRegs::LightingSampler;
+    using TextureType = Pica::TexturingRegs::TextureConfig::TextureType;
+    using WrapMode = Pica::TexturingRegs::TextureConfig::WrapMode;
+
+    // The logic op is only emulated when blending is disabled
+    if (framebuffer.alphablend_enable) {
+        framebuffer.requested_logic_op = {};
+    }
+
+    for (u32 i = 0; i < texture.tev_stages.size(); i++) {
+        texture.tev_stages[i] = CanonicalizeTevStage(texture.tev_stages[i], i);
+    }
+
+    if (texture.fog_mode != Pica::TexturingRegs::FogMode::Fog) {
+        texture.fog_flip.Assign(0);
+    }
+    const auto texture0_type = texture.texture0_type.Value();
+    if (texture0_type != TextureType::Shadow2D && texture0_type != TextureType::ShadowCube) {
+        texture.shadow_texture_orthographic.Assign(0);
+    }
+
+    // Wrap modes only matter for border color emulation
+    const auto canonical_wrap = [](WrapMode mode) {
+        return mode == WrapMode::ClampToBorder ? WrapMode::ClampToBorder : WrapMode::ClampToEdge;
+    };
+    for (u32 i = 0; i < texture.requested_wrap.size(); i++) {
+        auto& wrap = texture.requested_wrap[i];
+        if (i == 0 && texture0_type == TextureType::Disabled) {
+            wrap = {};
+            continue;
+        }
+        wrap.s = canonical_wrap(wrap.s);
+        wrap.t = canonical_wrap(wrap.t);
+    }
+
+    if (!lighting.enable) {
+        return;
+    }
+
+    const auto config = lighting.config.Value();
+    const auto clear_lut = [config](LutConfig& lut, LightingSampler sampler, bool used = true) {
+        if (!lut.enable || !used || !LightingRegs::IsLightingSamplerSupported(config, sampler)) {
+            lut = {};
+        }
+    };
+    clear_lut(lighting.lut_d0, LightingSampler::Distribution0);
+    clear_lut(lighting.lut_d1, LightingSampler::Distribution1);
+    clear_lut(lighting.lut_rr, LightingSampler::ReflectRed);
+    clear_lut(lighting.lut_rg, LightingSampler::ReflectGreen);
+    clear_lut(lighting.lut_rb, LightingSampler::ReflectBlue);
+    clear_lut(lighting.lut_fr, LightingSampler::Fresnel,
+              lighting.enable_primary_alpha || lighting.enable_secondary_alpha);
+
+    const bool spot_supported =
+        LightingRegs::IsLightingSamplerSupported(config, LightingSampler::SpotlightAttenuation);
+    const bool light_shadow_used =
+        lighting.enable_shadow && (lighting.shadow_primary || lighting.shadow_secondary);
+    bool spot_used = false;
+    for (auto& light : lighting.lights) {
+        if (!spot_supported) {
+            light.spot_atten_enable.Assign(0);
+        }
+        if (!light_shadow_used) {
+            light.shadow_enable.Assign(0);
+        }
+        spot_used |= light.spot_atten_enable != 0;
+    }
+    if (!spot_used) {
+        lighting.lut_sp = {};
+    }
+
+    if (lighting.bump_mode != Pica::LightingRegs::LightingBumpMode::NormalMap) {
+        lighting.bump_renorm.Assign(0);
+    }
+    if (lighting.bump_mode == Pica::LightingRegs::LightingBumpMode::None) {
+        lighting.bump_selector.Assign(0);
+    }
+}
+
 } // namespace Pica::Shader
@@ -378,6 +378,9 @@ static_assert(std::has_unique_object_representations_v<ProcTexConfig>);
 union UserConfig {
     u32 raw{};
     BitField<0, 1, u32> use_custom_normal;
+    // Evaluate the TEV stages, the combiner buffer updates and the alpha test from the
+    // uniforms instead of the FSConfig, see FSConfig::ClearUberTevState.
+    BitField<1, 1, u32> use_uber_tev;
 
     // Whether a FSConfig + UserConfig combination can be
     // cached to disk. Right now, this is true if the
@@ -410,6 +413,23 @@ struct FSConfig {
         texture.ApplyProfile(profile);
     }
 
+    /**
+     * Zeroes the fields that don't affect the generated shader under the rest of the config,
+     * such as the unused operands of a TEV stage or the LUTs the lighting config ignores,
+     * so that configs producing equivalent shaders share the same hash.
+     */
+    void Canonicalize();
+
+    /**
+     * Clears the state that uber shaders read from the uniforms, so that every config
+     * differing only in it shares the same uber shader.
+     */
+    void ClearUberTevState() {
+        framebuffer.alpha_test_func.Assign(Pica::FramebufferRegs::CompareFunc::Always);
+        texture.combiner_buffer_input.Assign(0);
+        texture.tev_stages = {};
+    }
+
     bool operator==(const FSConfig& other) const noexcept {
         return std::memcmp(this, &other, sizeof(FSConfig)) == 0;
     }
@@ -424,7 +444,8 @@ struct FSConfig {
     ProcTexConfig proctex;
 
     static consteval u64 StructHash() {
-        constexpr u64 STRUCT_VERSION = 0;
+        // Version 1: Cached configs are canonicalized
+        constexpr u64 STRUCT_VERSION = 1;
 
         using T = FSConfig;
         return Common::HashCombine(STRUCT_VERSION,
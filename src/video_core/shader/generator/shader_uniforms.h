@@ -61,9 +61,13 @@ struct FSUniformData {
     alignas(16) Common::Vec3f tex_lod_bias;
     alignas(16) Common::Vec4f tex_border_color[3];
     alignas(16) Common::Vec4f blend_color;
+    // Raw sources, modifiers, ops and scales of each tev stage, read by uber shaders
+    alignas(16) Common::Vec4u tev_stage_config[6];
+    // Combiner buffer input and alpha test function, read by uber shaders
+    alignas(16) Common::Vec4u tev_config;
 };
 
-static_assert(sizeof(FSUniformData) == 0x530,
+static_assert(sizeof(FSUniformData) == 0x5A0,
               "The size of the UniformData does not match the structure in the shader");
 static_assert(sizeof(FSUniformData) < 16384,
               "UniformData structure must be less than 16kb as per the OpenGL spec");
@@ -0,0 +1,119 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include "common/assert.h"
+#include "core/memory.h"
+#include "video_core/vertex_cache.h"
+
+namespace VideoCore {
+
+namespace {
+
+/// Number of draws reading a range before it is made resident. Ranges read only once are common
+/// for data the application regenerates every frame and are not worth tracking.
+constexpr u16 UsesBeforeUpload = 2;
+
+/// Number of CPU invalidations after which a range is considered dynamic and always streamed.
+constexpr u8 MaxInvalidations = 2;
+
+/// Upper bound of tracked ranges. Ranges which aren't resident are forgotten when it is reached.
+constexpr std::size_t MaxEntries = 16384;
+
+} // Anonymous namespace
+
+VertexCache::VertexCache(PageCountCallback update_pages_cached_count_)
+    : update_pages_cached_count{std::move(update_pages_cached_count_)} {}
+
+VertexCache::~VertexCache() = default;
+
+template <typename Func>
+void VertexCache::ForEachPage(PAddr addr, u32 size, Func&& func) {
+    const u32 page_end = (addr + size - 1) >> Memory::CITRA_PAGE_BITS;
+    for (u32 page = addr >> Memory::CITRA_PAGE_BITS; page <= page_end; ++page) {
+        func(page);
+    }
+}
+
+std::pair<VertexCache::Residency, u32> VertexCache::Lookup(const Key& key) {
+    if (key.size == 0 || key.size > MaxEntrySize) {
+        return {Residency::Stream, 0};
+    }
+
+    if (entries.size() >= MaxEntries && !entries.contains(key)) {
+        std::erase_if(entries, [](const auto& pair) { return !pair.second.resident; });
+    }
+
+    Entry& entry = entries[key];
+    if (entry.resident) {
+        return {Residency::Resident, entry.offset};
+    }
+    if (entry.invalidations >= MaxInvalidations) {
+        return {Residency::Stream, 0};
+    }
+    entry.uses = std::min<u16>(entry.uses + 1, UsesBeforeUpload);
+    return {entry.uses >= UsesBeforeUpload ? Residency::Upload : Residency::Stream, 0};
+}
+
+void VertexCache::Insert(const Key& key, u32 offset) {
+    Entry& entry = entries[key];
+    ASSERT(!entry.resident);
+    entry.offset = offset;
+    entry.resident = true;
+
+    ForEachPage(key.addr, key.size, [&](u32 page) { page_entries[page].push_back(key); });
+    update_pages_cached_count(key.addr, key.size, 1);
+}
+
+void VertexCache::InvalidateRegion(PAddr addr, u32 size) {
+    if (size == 0 || page_entries.empty()) {
+        return;
+    }
+
+    const PAddr end = addr + size;
+    ForEachPage(addr, size, [&](u32 page) {
+        const auto it = page_entries.find(page);
+        if (it == page_entries.end()) {
+            return;
+        }
+        // Evicting removes keys from the page vector, so iterate over a copy.
+        const std::vector<Key> keys = it->second;
+        for (const Key& key : keys) {
+            if (key.addr >= end || key.addr + key.size <= addr) {
+                continue;
+            }
+            Entry& entry = entries[key];
+            if (entry.resident) {
+                entry.invalidations++;
+                Evict(key, entry);
+            }
+        }
+    });
+}
+
+void VertexCache::Clear() {
+    for (auto& [key, entry] : entries) {
+        if (entry.resident) {
+            update_pages_cached_count(key.addr, key.size, -1);
+        }
+    }
+    entries.clear();
+    page_entries.clear();
+}
+
+void VertexCache::Evict(const Key& key, Entry& entry) {
+    entry.resident = false;
+    entry.uses = 0;
+
+    ForEachPage(key.addr, key.size, [&](u32 page) {
+        const auto it = page_entries.find(page);
+        std::erase(it->second, key);
+        if (it->second.empty()) {
+            page_entries.erase(it);
+        }
+    });
+    update_pages_cached_count(key.addr, key.size, -1);
+}
+
+} // namespace VideoCore
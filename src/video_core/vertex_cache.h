@@ -0,0 +1,90 @@
+// Copyright 2026 Azahar Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "common/common_types.h"
+#include "common/hash.h"
+
+namespace VideoCore {
+
+/**
+ * Tracks the guest vertex and index ranges which have a copy resident in a backend buffer, so
+ * draws reading unchanged data bind that copy instead of uploading the data again.
+ * The pages of resident ranges are kept marked as rasterizer cached, which makes CPU writes to
+ * them invalidate the copy. The backend owns the buffer itself and calls Clear when it recycles
+ * the memory holding the copies.
+ */
+class VertexCache {
+public:
+    /// Largest range that is kept resident. Bigger ranges are always streamed.
+    static constexpr u32 MaxEntrySize = 2 * 1024 * 1024;
+
+    /// Identifies a guest range together with the layout it was converted to in the buffer.
+    struct Key {
+        PAddr addr;
+        u32 size;
+        u32 layout; ///< Backend defined, e.g. the aligned vertex stride or the index type.
+
+        bool operator==(const Key&) const = default;
+    };
+
+    enum class Residency : u8 {
+        Resident, ///< The range has a valid copy in the buffer.
+        Upload,   ///< The range should be copied to the buffer and registered with Insert.
+        Stream,   ///< The range should be uploaded to the stream buffer as usual.
+    };
+
+    /// Increases or decreases the cached count of the pages touching a region.
+    using PageCountCallback = std::function<void(PAddr addr, u32 size, int delta)>;
+
+    explicit VertexCache(PageCountCallback update_pages_cached_count);
+    ~VertexCache();
+
+    /**
+     * Looks a range up.
+     * @returns How the range should be handled and, if resident, the offset of its copy.
+     */
+    std::pair<Residency, u32> Lookup(const Key& key);
+
+    /// Registers the copy of a range which Lookup asked to upload.
+    void Insert(const Key& key, u32 offset);
+
+    /// Drops the copies of any range overlapping the region.
+    void InvalidateRegion(PAddr addr, u32 size);
+
+    /// Drops all copies, as their buffer memory is about to be reused.
+    void Clear();
+
+private:
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const noexcept {
+            return Common::ComputeStructHash64(key);
+        }
+    };
+
+    struct Entry {
+        u32 offset = 0;
+        u16 uses = 0;
+        u8 invalidations = 0;
+        bool resident = false;
+    };
+
+    /// Calls func with the index of every page in the range.
+    template <typename Func>
+    static void ForEachPage(PAddr addr, u32 size, Func&& func);
+
+    /// Marks the entry as not resident and stops tracking its pages.
+    void Evict(const Key& key, Entry& entry);
+
+    PageCountCallback update_pages_cached_count;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    std::unordered_map<u32, std::vector<Key>> page_entries;
+};
+
+} // namespace VideoCore
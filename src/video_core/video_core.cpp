@@ -14,6 +14,7 @@
 #ifdef ENABLE_VULKAN
 #include "video_core/renderer_vulkan/renderer_vulkan.h"
 #endif
+#include "video_core/renderer_null/renderer_null.h"
 #include "video_core/video_core.h"
 
 #ifdef ENABLE_SDL2
@@ -45,6 +46,8 @@ std::unique_ptr<RendererBase> CreateRenderer(Frontend::EmuWindow& emu_window,
     case Settings::GraphicsAPI::OpenGL:
         return std::make_unique<OpenGL::RendererOpenGL>(system, pica, emu_window, secondary_window);
 #endif
+    case Settings::GraphicsAPI::Null:
+        return std::make_unique<NullRenderer::RendererNull>(system, emu_window);
     default:
         LOG_CRITICAL(Render,
                      "Unknown or unsupported graphics API {}, falling back to available default",
@@ -56,8 +59,7 @@ std::unique_ptr<RendererBase> CreateRenderer(Frontend::EmuWindow& emu_window,
 #elif ENABLE_SOFTWARE_RENDERER
         return std::make_unique<SwRenderer::RendererSoftware>(system, pica, emu_window);
 #else
-// TODO: Add a null renderer backend for this, perhaps.
-#error "At least one renderer must be enabled."
+        return std::make_unique<NullRenderer::RendererNull>(system, emu_window);
 #endif
     }
 }